@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "PLT/Bitmap.h"
@@ -48,6 +50,33 @@ public:
    //! Return reference to the bitmap implementation
    const PLT::Bitmap& getBitmap() const { return bitmap; }
 
+   //! Decode a .png file into caller provided 32-bit pixel storage
+   //
+   //! Scan-lines are decoded as they are inflated, so apart from the
+   //! buffer only two scan-lines of working memory are needed. Files
+   //! are only supported on hosted platforms
+   //! \param buffer storage for the pixels
+   //! \param pitch length of each line of the buffer (bytes)
+   //! \param width,height size of the buffer, updated to the image size
+   //! \return false on error or if the image does not fit in the buffer
+   static bool decodePNG(const std::string& filename,
+                         STB::Colour*       buffer,
+                         unsigned           pitch,
+                         unsigned&          width,
+                         unsigned&          height);
+
+   //! Decode a .png image held in memory e.g. flash into caller provided
+   //! 32-bit pixel storage
+   //
+   //! As above, and available on all targets
+   //! \param png,size the encoded image
+   static bool decodePNG(const uint8_t*     png,
+                         size_t             size,
+                         STB::Colour*       buffer,
+                         unsigned           pitch,
+                         unsigned&          width,
+                         unsigned&          height);
+
 private:
    // Implement GUI::Canvas
    virtual STB::Colour canvasGetPixel(int32_t x, int32_t y) const override
@@ -57,7 +86,14 @@ private:
 
    virtual const PLT::Image* canvasGetImage() const override { return &bitmap; }
 
-   virtual void canvasResize(uint32_t width, uint32_t height) override {}
+   virtual void canvasResize(uint32_t width, uint32_t height) override
+   {
+      // Keep pixels already loaded at this size e.g. by readFromFile()
+      if ((width != bitmap.getWidth()) || (height != bitmap.getHeight()))
+      {
+         bitmap.resize(width, height);
+      }
+   }
 
    virtual void canvasRefresh(int32_t x1, int32_t y1, int32_t x2, int32_t y2) override {}
 
@@ -0,0 +1,25 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "GUI/Bitmap.h"
+#include "GUI/Bitmap/PNG.h"
+
+namespace GUI {
+
+//! Decode a .png image in memory into 32-bit pixel storage
+bool Bitmap::decodePNG(const uint8_t* png,
+                       size_t         size,
+                       STB::Colour*   buffer,
+                       unsigned       pitch,
+                       unsigned&      width,
+                       unsigned&      height)
+{
+   PNG::MemorySource source{png, size};
+   BufferTarget      target{buffer, pitch, width, height};
+
+   return PNG().load(source, target);
+}
+
+}
@@ -18,709 +18,396 @@
 #include "STB/Colour.h"
 #include "STB/Endian.h"
 
+#include "PLT/File.h"
+
 #include "GUI/Bitmap.h"
+#include "GUI/Bitmap/PNG.h"
 
 
-class PNG
+//! Encoded PNG data read from a file
+class FileSource : public PNG::Source
 {
 public:
-   PNG() = default;
+   FileSource(FILE* fp_)
+      : fp(fp_)
+   {
+   }
 
-   ~PNG() = default;
+   bool read(void* data, size_t size) override
+   {
+      return fread(data, size, 1, fp) == 1;
+   }
 
-   bool load(PLT::Bitmap* bitmap, const std::string& filename)
+   bool skip(size_t size) override
    {
-      FILE* fp = fopen(filename.c_str(), "r");
-      if (fp == nullptr)
-      {
-         error("Failed to open file");
-         return false;
-      }
+      return fseek(fp, size, SEEK_CUR) == 0;
+   }
+
+private:
+   FILE* fp;
+};
 
-      char header[8];
-      if ((fread(header, sizeof(header), 1, fp) != 1) ||
-          (::strncmp(header, "\x89PNG\r\n\x1A\n", sizeof(header)) != 0))
-      {
-         error("Signature error");
-         fclose(fp);
-         return false;
-      }
 
-      Chunk chunk{fp};
+//! Decode a .png file
+static bool loadPNG(const std::string& filename, PNG::Target& target)
+{
+   FILE* fp = fopen(filename.c_str(), "r");
+   if (fp == nullptr)
+   {
+      return PNG::error("Failed to open file");
+   }
 
-      bool ok = true;
+   FileSource source{fp};
 
-      while(ok)
-      {
-         if (!chunk.readHeader()) break;
+   bool ok = PNG().load(source, target);
 
-              if (chunk.isType("IHDR")) { ok = processChunkIHDR(chunk); }
-         else if (chunk.isType("PLTE")) { ok = processChunkPLTE(chunk); }
-         else if (chunk.isType("IDAT")) { ok = processChunkIDAT(chunk); }
-         else if (chunk.isType("IEND")) { break; }
-         else                           { ok = chunk.skip(); }
-      }
+   fclose(fp);
 
-      fclose(fp);
+   return ok;
+}
 
-      if (ok)
-      {
-         buildImage(bitmap);
-      }
 
-      return ok;
+//! Decode into a PLT::Bitmap
+class BitmapTarget : public PNG::Target
+{
+public:
+   BitmapTarget(PLT::Bitmap& bitmap_)
+      : bitmap(bitmap_)
+   {
    }
 
 private:
-   //! PNG file chunck
-   class Chunk
+   bool begin(unsigned width, unsigned height) override
    {
-   public:
-      Chunk(FILE* fp_)
-         : fp(fp_)
-      {}
+      bitmap.resize(width, height);
 
-      //! Read chunk header
-      bool readHeader()
-      {
-         if (remaining_data_bytes != 0) return false;
-         if (fread(&header, sizeof(Header), 1, fp) != 1) return false;
+      storage = bitmap.getStorage(pitch);
 
-         remaining_data_bytes = header.length;
-         return true;
-      }
-
-      //! Check type of this chunk
-      bool isType(const char* type_) const
+      // Rows can be written in place when the bitmap uses 32-bit pixels
+      if ((storage == nullptr) || (PLT::Image::getPixelBits() != 32))
       {
-         return ::strncmp(header.type, type_, 4) == 0;
+         storage = nullptr;
+         row.resize(width);
       }
 
-      //! Get chunck type
-      std::string getType() const
-      {
-         std::string type;
-         for(size_t i=0; i<sizeof(header.type); i++)
-            type += header.type[i];
-         return type;
-      }
-
-      //! Return number of data bytes still to be read from the current chunk
-      size_t getRemaining() const
-      {
-         return remaining_data_bytes;
-      }
-
-      //! Read some chunk data
-      bool read(void* data, size_t length)
-      {
-         if (length > remaining_data_bytes) return false;
-         if (fread(data, length, 1, fp) != 1) return false;
-
-         // TODO accumulate CRC
-         remaining_data_bytes -= length;
-         return true;
-      }
-
-      //! Read some chunk data
-      template <typename TYPE>
-      bool read(TYPE& data)
-      {
-         return read(&data, sizeof(TYPE));
-      }
-
-      //! Skip all remaining chunk data (and the CRC)
-      bool skip()
-      {
-         size_t offset_to_next_chunk = remaining_data_bytes + sizeof(uint32_t);
-         remaining_data_bytes = 0;
-         return fseek(fp, offset_to_next_chunk, SEEK_CUR) == 0;
-      }
-
-      //! Read and validate the CRC
-      bool checkCRC()
-      {
-         if (remaining_data_bytes != 0) return false;
-         if (fread(&crc, sizeof(crc), 1, fp) != 1) return false;
-
-         // TODO compare CRC
-         return true;
-      }
-
-   private:
-      struct Header
-      {
-         STB::Big32 length{0};
-         char       type[4];
-      };
-
-      FILE*      fp{nullptr};
-      Header     header;
-      size_t     remaining_data_bytes{0};
-      STB::Big32 crc{0};
-   };
+      return true;
+   }
 
-   class FileStream : public STB::ZLib::Io
+   STB::Colour* getRow(unsigned y) override
    {
-   public:
-      FileStream(Chunk& chunk_, std::vector<uint8_t>& out_)
-         : chunk(chunk_)
-         , out(out_)
-      {
-      }
-
-      //! Get next byte from input stream
-      static uint8_t get_byte(void *that)
-      {
-         FileStream* file = (FileStream*) that;
-         return file->getByte();
-      }
-
-   private:
-      static const size_t BUFFER_SIZE = 512;
-
-      //! Get next byte from input stream
-      virtual uint8_t getByte() override
-      {
-         if (index == limit)
-         {
-            // Buffer exhausted => refill
-
-            if (chunk.getRemaining() == 0)
-            {
-               // Chunck exhausted => load next chunk
-               if (!chunk.checkCRC())
-               {
-                  error("PNG CRC error");
-               }
-
-               // Read next chunck
-               if (!chunk.readHeader())
-               {
-                  error("PNG header read failure");
-               }
-               else if (chunk.getType() != "IDAT")
-               {
-                  error("PNG unexpected chunk type");
-               }
-            }
-
-            limit = std::min(chunk.getRemaining(), sizeof(buffer));
-
-            if (!chunk.read(buffer, limit))
-            {
-               error("PNG data read error");
-            }
-
-            index = 0;
-         }
-
-         return buffer[index++];
-      }
+      return storage != nullptr ? (STB::Colour*)(storage + y * pitch)
+                                : row.data();
+   }
 
-      //! Recieve next image byte
-      virtual void putByte(uint8_t byte) override
-      {
-          out.push_back(byte);
-      }
+   void endRow(unsigned y) override
+   {
+      if (storage != nullptr) return;
 
-      virtual void error(const std::string& message) override
+      for(unsigned x = 0; x < row.size(); x++)
       {
-         fprintf(stderr, "ERR: %s\n", message.c_str());
+         bitmap.point(row[x], x, y);
       }
+   }
 
-      Chunk&  chunk;
-      size_t  index{0};
-      size_t  limit{0};
-      uint8_t buffer[BUFFER_SIZE];
+   PLT::Bitmap&             bitmap;
+   uint8_t*                 storage{nullptr};
+   unsigned                 pitch{0};
+   std::vector<STB::Colour> row{};
+};
 
-      std::vector<uint8_t>& out;
-   };
 
-   bool error(const std::string& message)
+//! Encode a canvas as an 8-bit RGB PNG file
+class PNGWriter : public STB::ZLib::Io
+{
+public:
+   PNGWriter(const GUI::Canvas& canvas_)
+      : canvas(canvas_)
+      , width(canvas_.getWidth())
+      , height(canvas_.getHeight())
+      , pitch(width * BYTES_PER_PIXEL)
    {
-      fprintf(stderr, "ERR: PNG %s\n", message.c_str());
-      return false;
    }
 
-   static const uint8_t PNG_COLOUR_GREY       = 0;
-   static const uint8_t PNG_COLOUR_RGB        = 2;
-   static const uint8_t PNG_COLOUR_INDEXED    = 3;
-   static const uint8_t PNG_COLOUR_GREY_ALPHA = 4;
-   static const uint8_t PNG_COLOUR_RGB_ALPHA  = 6;
+   bool save(const char* name)
+   {
+      PLT::File file(nullptr, name, "png");
 
-   static const uint8_t PNG_INTERLACE_NONE  = 0;
-   static const uint8_t PNG_INTERLACE_ADAM7 = 1;
+      if (!file.openForWrite()) return false;
 
-   static const uint8_t PNG_FILTER_METHOD_ZERO = 0;
+      out = &file;
 
-   static const uint8_t PNG_COMPRESSION_ZLIB = 0;
+      put("\x89PNG\r\n\x1A\n", 8);
 
-   //! Read and process the IHDR chunk
-   bool processChunkIHDR(Chunk& chunk)
-   {
       struct ChunkIHDR
       {
          STB::Big32 width;
          STB::Big32 height;
          uint8_t    bit_depth{8};
          uint8_t    colour_type{PNG_COLOUR_RGB};
-         uint8_t    compression_method{PNG_COMPRESSION_ZLIB};
-         uint8_t    filter_method{PNG_FILTER_METHOD_ZERO};
-         uint8_t    interlace_method{PNG_INTERLACE_NONE};
+         uint8_t    compression_method{0};
+         uint8_t    filter_method{0};
+         uint8_t    interlace_method{0};
       };
 
       ChunkIHDR ihdr;
 
-      if (!chunk.read(ihdr))
-      {
-         return error("failed to read IHDR");
-      }
+      ihdr.width  = width;
+      ihdr.height = height;
 
-      if ((ihdr.interlace_method != PNG_INTERLACE_NONE) ||
-          (ihdr.compression_method != PNG_COMPRESSION_ZLIB))
-      {
-         return error("unsupported format in IHDR");
-      }
+      writeChunk("IHDR", &ihdr, 13);
 
-      colour_type = ihdr.colour_type;
-      width       = ihdr.width;
-      height      = ihdr.height;
-      bit_depth   = ihdr.bit_depth;
+      // Filtered scan-lines are pulled by the compressor through read() and
+      // the compressed stream is split into IDAT chunks by write()
+      prev.assign(pitch, 0);
+      curr.resize(pitch);
+      line.resize(pitch + 1);
+      trial.resize(pitch + 1);
+      offset = line.size();
 
-      switch(colour_type)
-      {
-      case PNG_COLOUR_GREY:
-         bytes_per_pixel = (bit_depth + 7) / 8;
-         pitch           = (bit_depth * width) / 8 + 1;
-         break;
+      STB::ZLib zlib{this};
+      (void) zlib.deflate();
 
-      case PNG_COLOUR_RGB:
-         bytes_per_pixel = (bit_depth / 8) * 3;
-         pitch           = bytes_per_pixel * width + 1;
-         break;
-
-      case PNG_COLOUR_INDEXED:
-         bytes_per_pixel = 1;
-         pitch           = (bit_depth * width) / 8 + 1;
-         break;
-
-      case PNG_COLOUR_GREY_ALPHA:
-         bytes_per_pixel = (bit_depth / 8) * 2;
-         pitch           = bytes_per_pixel * width + 1;
-         break;
-
-      case PNG_COLOUR_RGB_ALPHA:
-         bytes_per_pixel = (bit_depth / 8) * 4;
-         pitch           = bytes_per_pixel * width + 1;
-         break;
+      flushIDAT();
 
-      default:
-         return error("unsupported colour type");
-      }
+      writeChunk("IEND", nullptr, 0);
 
-      image.reserve(height * pitch);
+      out = nullptr;
 
-      return checkCRC(chunk);
+      return ok;
    }
 
-   //! Read and process the PLTE chunk
-   bool processChunkPLTE(Chunk& chunk)
-   {
-      unsigned size = chunk.getRemaining() / 3;
+private:
+   static const unsigned BYTES_PER_PIXEL = 3;
+   static const size_t   IDAT_SIZE       = 0x8000;
+   static const uint8_t  PNG_COLOUR_RGB  = 2;
 
-      palette.resize(1<<bit_depth);
+   static const uint8_t FILTER_NONE  = 0;
+   static const uint8_t FILTER_SUB   = 1;
+   static const uint8_t FILTER_UP    = 2;
+   static const uint8_t FILTER_PAETH = 4;
 
-      if (size != palette.size())
-      {
-         return error("PLTE size error");
-      }
+   //! Update a CRC-32 (ISO-3309) with a span of data
+   static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t size)
+   {
+      static uint32_t table[256] = {};
 
-      for(unsigned index = 0; index < size; index++)
+      if (table[1] == 0)
       {
-         struct RGB
+         for(uint32_t n = 0; n < 256; n++)
          {
-            uint8_t red, grn, blu;
-         };
-
-         RGB entry;
-
-         if (!chunk.read(entry))
-         {
-            return error("PLTE read error");
+            uint32_t c = n;
+            for(unsigned k = 0; k < 8; k++)
+            {
+               c = (c & 1) != 0 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
          }
-
-         palette[index] = STB::RGBA(entry.red, entry.grn, entry.blu, 0xFF);
       }
 
-      return checkCRC(chunk);
-   }
-
-   //! Read and process the IDAT chunk
-   bool processChunkIDAT(Chunk& chunk)
-   {
-      FileStream file{chunk, image};
-      STB::ZLib  zlib{&file};
+      crc = ~crc;
 
-      (void) zlib.inflate();
+      for(size_t i = 0; i < size; i++)
+      {
+         crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+      }
 
-      return checkCRC(chunk);
+      return ~crc;
    }
 
-   bool checkCRC(Chunk& chunk)
+   //! Write raw data to the file
+   void put(const void* data, size_t size)
    {
-      if (!chunk.checkCRC())
+      if (ok && (size != 0))
       {
-         std::string message = "CRC error in ";
-         message += chunk.getType();
-         return error(message);
+         ok = out->write(data, size);
       }
-      return true;
    }
 
-   //! Reverse average filter to re-create a scan-line
-   void avgFilter(uint8_t* line, bool first)
+   //! Write a complete chunk
+   void writeChunk(const char* type, const void* data, size_t size)
    {
-      if (first)
-      {
-         for(unsigned i = bytes_per_pixel; i < (pitch - 1); i++)
-         {
-            uint8_t& x = line[i];
-            uint8_t  a = line[i - bytes_per_pixel];
-            x = x + a/2;
-         }
-      }
-      else
-      {
-         unsigned i;
+      STB::Big32 length = uint32_t(size);
 
-         for(i = 0; i < bytes_per_pixel; i++)
-         {
-            uint8_t& x = line[i];
-            uint8_t  b = line[signed(i) - signed(pitch)];
-            x = x + b/2;
-         }
+      put(&length, sizeof(length));
+      put(type, 4);
+      put(data, size);
 
-         for(; i < (pitch - 1); i++)
-         {
-            uint8_t& x = line[i];
-            uint8_t  a = line[i - bytes_per_pixel];
-            uint8_t  b = line[signed(i) - signed(pitch)];
-            x = x + (a + b)/2;
-         }
-      }
+      uint32_t crc = crc32(0, (const uint8_t*)type, 4);
+      crc = crc32(crc, (const uint8_t*)data, size);
+
+      STB::Big32 big_crc = crc;
+      put(&big_crc, sizeof(big_crc));
    }
 
-   //! Reverse PAETH filter to re-create a scan-line
-   void paethFilter(uint8_t* line, bool first)
+   //! Write compressed data collected so far as an IDAT chunk
+   void flushIDAT()
    {
-      if (first)
+      if (idat.empty()) return;
+
+      writeChunk("IDAT", idat.data(), idat.size());
+      idat.clear();
+   }
+
+   //! Convert a row of the canvas to RGB bytes
+   void buildLine(unsigned y, uint8_t* rgb)
+   {
+      const PLT::Image* image = canvas.getImage();
+      unsigned          image_pitch;
+      const uint8_t*    storage = image != nullptr ? image->getStorage(image_pitch) : nullptr;
+
+      if ((storage != nullptr) && (PLT::Image::getPixelBits() == 32))
       {
-         for(unsigned i = bytes_per_pixel; i < (pitch - 1); i++)
+         const uint32_t* pixels = (const uint32_t*)(storage + y * image_pitch);
+
+         for(unsigned x = 0; x < width; x++)
          {
-            uint8_t& x = line[i];
-            uint8_t  a = line[i - bytes_per_pixel];
-            x = x + a;
+            STB::ColourDecode pixel = pixels[x];
+
+            *rgb++ = pixel.red();
+            *rgb++ = pixel.grn();
+            *rgb++ = pixel.blu();
          }
       }
       else
       {
-         unsigned i;
-
-         for(i = 0; i < bytes_per_pixel; i++)
-         {
-            uint8_t& x = line[i];
-            uint8_t  b = line[signed(i) - signed(pitch)];
-            x = x + b;
-         }
-
-         for(; i < (pitch - 1); i++)
+         for(unsigned x = 0; x < width; x++)
          {
-            uint8_t& x = line[i];
-            uint8_t  a = line[i - bytes_per_pixel];
-            uint8_t  b = line[signed(i) - signed(pitch)];
-            uint8_t  c = line[signed(i) - signed(pitch) - bytes_per_pixel];
-
-            signed   p  = a + b - c;
-            unsigned pa = abs(p - a);
-            unsigned pb = abs(p - b);
-            unsigned pc = abs(p - c);
+            STB::ColourDecode pixel = canvas.getPixel(x, y);
 
-            if ((pa <= pb) && (pa <= pc))
-            {
-               x = x + a;
-            }
-            else if (pb <= pc)
-            {
-               x = x + b;
-            }
-            else
-            {
-               x = x + c;
-            }
+            *rgb++ = pixel.red();
+            *rgb++ = pixel.grn();
+            *rgb++ = pixel.blu();
          }
       }
    }
 
-   //! Reverse a scan-line filter
-   uint8_t* reverseFilter(unsigned y)
+   //! Apply a scan-line filter to the current row \return a cost estimate
+   unsigned filterLine(uint8_t filter, uint8_t* dst)
    {
-      const uint8_t FILTER_NONE    = 0;
-      const uint8_t FILTER_SUB     = 1;
-      const uint8_t FILTER_UP      = 2;
-      const uint8_t FILTER_AVERAGE = 3;
-      const uint8_t FILTER_PAETH   = 4;
-
-      bool     first  = (y == 0);
-      uint8_t* line   = &image[pitch * y];
-      uint8_t  filter = *line++;
+      const uint8_t* x   = curr.data();
+      const uint8_t* b   = prev.data();
+      const unsigned bpp = BYTES_PER_PIXEL;
+      unsigned       cost = 0;
 
-      switch(filter)
+      for(unsigned i = 0; i < pitch; i++)
       {
-      case FILTER_NONE:
-         break;
+         uint8_t a = i >= bpp ? x[i - bpp] : 0;
+         uint8_t c = i >= bpp ? b[i - bpp] : 0;
+         uint8_t p;
 
-      case FILTER_SUB:
-         for(unsigned i = bytes_per_pixel; i < (pitch - 1); i++)
+         switch(filter)
          {
-            uint8_t& x = line[i];
-            uint8_t  a = line[i - bytes_per_pixel];
-            x = x + a;
-         }
-         break;
+         case FILTER_SUB: p = a;    break;
+         case FILTER_UP:  p = b[i]; break;
 
-      case FILTER_UP:
-         if (!first)
+         case FILTER_PAETH:
          {
-            for(unsigned i = 0; i < (pitch - 1); i++)
-            {
-               uint8_t& x = line[i];
-               uint8_t  b = line[signed(i) - signed(pitch)];
-               x = x + b;
-            }
+            signed   est = a + b[i] - c;
+            unsigned pa  = abs(est - a);
+            unsigned pb  = abs(est - b[i]);
+            unsigned pc  = abs(est - c);
+
+                 if ((pa <= pb) && (pa <= pc)) p = a;
+            else if (pb <= pc)                 p = b[i];
+            else                               p = c;
          }
          break;
 
-      case FILTER_AVERAGE:
-         avgFilter(line, first);
-         break;
+         default: p = 0; break;
+         }
 
-      case FILTER_PAETH:
-         paethFilter(line, first);
-         break;
+         uint8_t value = x[i] - p;
+         dst[i] = value;
 
-      default:
-         error("unexpected filter type");
+         // Sum of absolute differences, treating the bytes as signed
+         cost += value < 0x80 ? value : 0x100 - value;
       }
 
-      return line;
+      return cost;
    }
 
-   //! Render a line of grey pixels
-   void buildLineGrey(const uint8_t* line, unsigned y, PLT::Bitmap* bitmap)
+   //! Build the next filtered scan-line, choosing the filter with lowest cost
+   void nextLine()
    {
-      for(unsigned x = 0; x < width;)
-      {
-         uint8_t byte = *line++;
-         uint8_t level;
+      std::swap(prev, curr);
+      buildLine(row++, curr.data());
 
-         switch(bit_depth)
-         {
-         case 1:
-            for(int bit = 7; bit >= 0; bit--)
-            {
-               static uint8_t pal_1bit[2] = {0x00, 0xFF};
-
-               level = pal_1bit[(byte >> bit) & 0b1];
-               bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-            }
-            break;
-
-         case 2:
-            for(int lsb = 6; lsb >= 0; lsb -= 2)
-            {
-               static uint8_t pal_2bit[4] = {0x00, 0x55, 0xAA, 0xFF};
-
-               level = pal_2bit[(byte >> lsb) & 0b11];
-               bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-            }
-            break;
-
-         case 4:
-            level = byte & 0b1111;
-            level = (level << 4) | level;
-            bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-
-            level = byte >> 4;
-            level = (level << 4) | level;
-            bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-            break;
-
-         case 8:
-            level = byte;
-            bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-            break;
-
-         case 16:
-            level = byte;
-            bitmap->point(STB::RGBA(level, level, level, 0xFF), x++, y);
-            // XXX LS 8 bits ignored
-            line++;
-            break;
-
-         default:
-            assert(!"unexpected depth");;
-         }
-      }
-   }
+      line[0] = FILTER_NONE;
+      unsigned best_cost = filterLine(FILTER_NONE, &line[1]);
 
-   //! Render a line of RGB pixels
-   void buildLineRGB(const uint8_t* line, unsigned y, PLT::Bitmap* bitmap)
-   {
-      for(unsigned x = 0; x < width; x++)
+      for(uint8_t filter : {FILTER_SUB, FILTER_UP, FILTER_PAETH})
       {
-         switch(bit_depth)
+         unsigned cost = filterLine(filter, &trial[1]);
+
+         if (cost < best_cost)
          {
-         case 8:
-            bitmap->point(STB::RGBA(line[0], line[1], line[2], 0xFF), x, y);
-            line += 3;
-            break;
-
-         case 16:
-            // XXX LS 8 bits of each channel ignored
-            bitmap->point(STB::RGBA(line[0], line[2], line[4], 0xFF), x, y);
-            line += 6;
-            break;
-
-         default:
-            assert(!"unexpected depth");;
+            trial[0]  = filter;
+            best_cost = cost;
+            std::swap(line, trial);
          }
       }
+
+      offset = 0;
    }
 
-   //! Render a line of palette indexed pixels
-   void buildLineIndexed(const uint8_t* line, unsigned y, PLT::Bitmap* bitmap)
+   //! Supply filtered scan-lines to the compressor
+   virtual size_t read(uint8_t* data, size_t size) override
    {
-      //assert(palette->size() >= (1<<bit_depth)); TODO
+      size_t len = 0;
 
-      for(unsigned x = 0; x < width;)
+      while(len < size)
       {
-         uint8_t byte = *line++;
-         uint8_t index;
-
-         switch(bit_depth)
+         if (offset == line.size())
          {
-         case 1:
-            for(int bit = 7; bit >= 0; bit--)
-            {
-               index = (byte >> bit) & 0b1;
-               bitmap->point(palette[index], x++, y);
-            }
-            break;
+            if (row == height) break;
 
-         case 2:
-            for(int lsb = 6; lsb >= 0; lsb -= 2)
-            {
-               index = (byte >> lsb) & 0b11;
-               bitmap->point(palette[index], x++, y);
-            }
-            break;
-
-         case 4:
-            index = byte & 0b1111;
-            bitmap->point(palette[index], x++, y);
-
-            index = byte >> 4;
-            bitmap->point(palette[index], x++, y);
-            break;
+            nextLine();
+         }
 
-         case 8:
-            index = byte;
-            bitmap->point(palette[index], x++, y);
-            break;
+         size_t n = std::min(size - len, line.size() - offset);
 
-         default:
-            error("unexpected depth");
-         }
+         memcpy(data + len, &line[offset], n);
+         offset += n;
+         len    += n;
       }
-   }
 
-   //! Render a line of RGB with alpha pixels
-   void buildLineRGBA(const uint8_t* line, unsigned y, PLT::Bitmap* bitmap)
-   {
-      for(unsigned x = 0; x < width; x++)
-      {
-         switch(bit_depth)
-         {
-         case 8:
-            bitmap->point(STB::RGBA(line[0], line[1], line[2], line[3]), x, y);
-            line += 4;
-            break;
-
-         case 16:
-            // XXX LS 8 bits of each channel ignored
-            bitmap->point(STB::RGBA(line[0], line[2], line[4], line[6]), x, y);
-            line += 8;
-            break;
-
-         default:
-            error("unexpected depth");
-         }
-      }
+      return len;
    }
 
-   //! Render a line of grey with alpha pixels
-   void buildLineGreyAlpha(const uint8_t* line, unsigned y, PLT::Bitmap* bitmap)
+   //! Receive compressed image data
+   virtual void write(const uint8_t* data, size_t size) override
    {
-      for(unsigned x = 0; x < width; x++)
+      while(size != 0)
       {
-         switch(bit_depth)
-         {
-         case 8:
-            bitmap->point(STB::RGBA(line[0], line[0], line[0], line[1]), x, y);
-            line += 2;
-            break;
-
-         case 16:
-            // XXX LS 8 bits ignored
-            bitmap->point(STB::RGBA(line[0], line[0], line[0], line[2]), x, y);
-            line += 4;
-            break;
-
-         default:
-            error("unexpected depth");
-         }
+         size_t n = std::min(size, IDAT_SIZE - idat.size());
+
+         idat.insert(idat.end(), data, data + n);
+         data += n;
+         size -= n;
+
+         if (idat.size() == IDAT_SIZE) flushIDAT();
       }
    }
 
-   //! Translate decompressed PNG image data into pixels
-   void buildImage(PLT::Bitmap* bitmap)
+   virtual void error(const std::string& message) override
    {
-      bitmap->resize(width, height);
-
-      for(unsigned y=0; y < height; y++)
-      {
-         uint8_t* line = reverseFilter(y);
-
-         switch(colour_type)
-         {
-         case PNG_COLOUR_GREY:       buildLineGrey(     line, y, bitmap); break;
-         case PNG_COLOUR_RGB:        buildLineRGB(      line, y, bitmap); break;
-         case PNG_COLOUR_INDEXED:    buildLineIndexed(  line, y, bitmap); break;
-         case PNG_COLOUR_RGB_ALPHA:  buildLineRGBA(     line, y, bitmap); break;
-         case PNG_COLOUR_GREY_ALPHA: buildLineGreyAlpha(line, y, bitmap); break;
-         }
-      }
+      fprintf(stderr, "ERR: PNG %s\n", message.c_str());
+      ok = false;
    }
 
-   unsigned                  width{0};
-   unsigned                  height{0};
-   unsigned                  pitch{0};
-   uint8_t                   colour_type{0};
-   uint8_t                   bit_depth{0};
-   uint8_t                   bytes_per_pixel{8};
-   std::vector<STB::Colour>  palette{};
-   std::vector<uint8_t>      image{};
+   const GUI::Canvas&   canvas;
+   unsigned             width;
+   unsigned             height;
+   unsigned             pitch;
+   PLT::File*           out{nullptr};
+   bool                 ok{true};
+   unsigned             row{0};
+   size_t               offset{0};
+   std::vector<uint8_t> prev{};
+   std::vector<uint8_t> curr{};
+   std::vector<uint8_t> line{};   //!< Filter type and filtered scan-line
+   std::vector<uint8_t> trial{};
+   std::vector<uint8_t> idat{};
 };
 
 
@@ -729,7 +416,27 @@ namespace GUI {
 //! Read bitmap from .png file
 bool Bitmap::readPNG(const std::string& filename)
 {
-   return PNG().load(&bitmap, filename);
+   BitmapTarget target{bitmap};
+
+   return loadPNG(filename, target);
+}
+
+//! Decode a .png file into 32-bit pixel storage
+bool Bitmap::decodePNG(const std::string& filename,
+                       STB::Colour*       buffer,
+                       unsigned           pitch,
+                       unsigned&          width,
+                       unsigned&          height)
+{
+   BufferTarget target{buffer, pitch, width, height};
+
+   return loadPNG(filename, target);
+}
+
+//! Write canvas to a .png file
+bool Canvas::savePNG(const char* name) const
+{
+   return PNGWriter(*this).save(name);
 }
 
 }
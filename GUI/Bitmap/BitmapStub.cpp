@@ -13,4 +13,20 @@ bool Bitmap::readPNG(const std::string& filename)
    return false;
 }
 
+//! Decode a .png file into 32-bit pixel storage
+bool Bitmap::decodePNG(const std::string& filename,
+                       STB::Colour*       buffer,
+                       unsigned           pitch,
+                       unsigned&          width,
+                       unsigned&          height)
+{
+   return false;
+}
+
+//! Write canvas to a .png file
+bool Canvas::savePNG(const char* name) const
+{
+   return false;
+}
+
 }
@@ -0,0 +1,843 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2019 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// PNG decoder, see RFC-2083
+//
+// Reads from a PNG::Source so that images can be decoded from a file on
+// hosted platforms or from memory e.g. flash on MCU targets
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "STB/Zlib.h"
+#include "STB/Colour.h"
+#include "STB/Endian.h"
+
+class PNG
+{
+public:
+   //! Destination for decoded pixels
+   class Target
+   {
+   public:
+      //! Prepare for an image of the given size \return false to abandon the decode
+      virtual bool begin(unsigned width, unsigned height) = 0;
+
+      //! Get storage for a row of 32-bit pixels
+      virtual STB::Colour* getRow(unsigned y) = 0;
+
+      //! Row returned by getRow() is complete
+      virtual void endRow(unsigned y) {}
+   };
+
+   //! Source of encoded PNG data
+   class Source
+   {
+   public:
+      //! Read the next size bytes \return false if they are not available
+      virtual bool read(void* data, size_t size) = 0;
+
+      //! Skip over the next size bytes \return false if they are not available
+      virtual bool skip(size_t size) = 0;
+   };
+
+   //! Encoded PNG data held in memory e.g. an asset in flash
+   class MemorySource : public Source
+   {
+   public:
+      MemorySource(const uint8_t* data_, size_t size_)
+         : data(data_)
+         , remaining(size_)
+      {
+      }
+
+      bool read(void* out, size_t size) override
+      {
+         if (size > remaining) return false;
+
+         memcpy(out, data, size);
+         data      += size;
+         remaining -= size;
+         return true;
+      }
+
+      bool skip(size_t size) override
+      {
+         if (size > remaining) return false;
+
+         data      += size;
+         remaining -= size;
+         return true;
+      }
+
+   private:
+      const uint8_t* data;
+      size_t         remaining;
+   };
+
+   PNG() = default;
+
+   ~PNG() = default;
+
+   //! Decode a PNG image
+   bool load(Source& source, Target& target)
+   {
+      char header[8];
+      if (!source.read(header, sizeof(header)) ||
+          (::strncmp(header, "\x89PNG\r\n\x1A\n", sizeof(header)) != 0))
+      {
+         return error("Signature error");
+      }
+
+      Chunk chunk{source};
+
+      bool ok = true;
+
+      while(ok)
+      {
+         if (!chunk.readHeader())
+         {
+            ok = error("missing IDAT");
+            break;
+         }
+
+              if (chunk.isType("IHDR")) { ok = processChunkIHDR(chunk); }
+         else if (chunk.isType("PLTE")) { ok = processChunkPLTE(chunk); }
+         else if (chunk.isType("IDAT")) { ok = processChunkIDAT(chunk, target); break; }
+         else if (chunk.isType("IEND")) { ok = error("missing IDAT"); }
+         else                           { ok = chunk.skip(); }
+      }
+
+      return ok;
+   }
+
+   //! Report an error \return false
+   static bool error(const std::string& message)
+   {
+      fprintf(stderr, "ERR: PNG %s\n", message.c_str());
+      return false;
+   }
+
+private:
+   //! PNG file chunck
+   class Chunk
+   {
+   public:
+      Chunk(Source& source_)
+         : source(source_)
+      {}
+
+      //! Read chunk header
+      bool readHeader()
+      {
+         if (remaining_data_bytes != 0) return false;
+         if (!source.read(&header, sizeof(Header))) return false;
+
+         remaining_data_bytes = header.length;
+         return true;
+      }
+
+      //! Check type of this chunk
+      bool isType(const char* type_) const
+      {
+         return ::strncmp(header.type, type_, 4) == 0;
+      }
+
+      //! Get chunck type
+      std::string getType() const
+      {
+         std::string type;
+         for(size_t i=0; i<sizeof(header.type); i++)
+            type += header.type[i];
+         return type;
+      }
+
+      //! Return number of data bytes still to be read from the current chunk
+      size_t getRemaining() const
+      {
+         return remaining_data_bytes;
+      }
+
+      //! Read some chunk data
+      bool read(void* data, size_t length)
+      {
+         if (length > remaining_data_bytes) return false;
+         if (!source.read(data, length)) return false;
+
+         // TODO accumulate CRC
+         remaining_data_bytes -= length;
+         return true;
+      }
+
+      //! Read some chunk data
+      template <typename TYPE>
+      bool read(TYPE& data)
+      {
+         return read(&data, sizeof(TYPE));
+      }
+
+      //! Skip all remaining chunk data (and the CRC)
+      bool skip()
+      {
+         size_t offset_to_next_chunk = remaining_data_bytes + sizeof(uint32_t);
+         remaining_data_bytes = 0;
+         return source.skip(offset_to_next_chunk);
+      }
+
+      //! Read and validate the CRC
+      bool checkCRC()
+      {
+         if (remaining_data_bytes != 0) return false;
+         if (!source.read(&crc, sizeof(crc))) return false;
+
+         // TODO compare CRC
+         return true;
+      }
+
+   private:
+      struct Header
+      {
+         STB::Big32 length{0};
+         char       type[4];
+      };
+
+      Source&    source;
+      Header     header;
+      size_t     remaining_data_bytes{0};
+      STB::Big32 crc{0};
+   };
+
+   class DataStream : public STB::ZLib::Io
+   {
+   public:
+      DataStream(Chunk& chunk_)
+         : chunk(chunk_)
+      {
+      }
+
+   private:
+      //! Read compressed data, continuing into following IDAT chunks
+      virtual size_t read(uint8_t* data, size_t size) override
+      {
+         while (chunk.getRemaining() == 0)
+         {
+            if (end) return 0;
+
+            // Chunck exhausted => load next chunk
+            if (!chunk.checkCRC())
+            {
+               error("PNG CRC error");
+               return 0;
+            }
+
+            // Read next chunck
+            if (!chunk.readHeader())
+            {
+               error("PNG header read failure");
+               return 0;
+            }
+            else if (!chunk.isType("IDAT"))
+            {
+               // End of the image data
+               end = true;
+               return 0;
+            }
+         }
+
+         size_t len = std::min(chunk.getRemaining(), size);
+
+         if (!chunk.read(data, len))
+         {
+            error("PNG data read error");
+            return 0;
+         }
+
+         return len;
+      }
+
+      virtual void error(const std::string& message) override
+      {
+         fprintf(stderr, "ERR: %s\n", message.c_str());
+      }
+
+      Chunk& chunk;
+      bool   end{false};
+   };
+
+   static const uint8_t PNG_COLOUR_GREY       = 0;
+   static const uint8_t PNG_COLOUR_RGB        = 2;
+   static const uint8_t PNG_COLOUR_INDEXED    = 3;
+   static const uint8_t PNG_COLOUR_GREY_ALPHA = 4;
+   static const uint8_t PNG_COLOUR_RGB_ALPHA  = 6;
+
+   static const uint8_t PNG_INTERLACE_NONE  = 0;
+   static const uint8_t PNG_INTERLACE_ADAM7 = 1;
+
+   static const uint8_t PNG_FILTER_METHOD_ZERO = 0;
+
+   static const uint8_t PNG_COMPRESSION_ZLIB = 0;
+
+   //! Read and process the IHDR chunk
+   bool processChunkIHDR(Chunk& chunk)
+   {
+      struct ChunkIHDR
+      {
+         STB::Big32 width;
+         STB::Big32 height;
+         uint8_t    bit_depth{8};
+         uint8_t    colour_type{PNG_COLOUR_RGB};
+         uint8_t    compression_method{PNG_COMPRESSION_ZLIB};
+         uint8_t    filter_method{PNG_FILTER_METHOD_ZERO};
+         uint8_t    interlace_method{PNG_INTERLACE_NONE};
+      };
+
+      ChunkIHDR ihdr;
+
+      if (!chunk.read(ihdr))
+      {
+         return error("failed to read IHDR");
+      }
+
+      if ((ihdr.interlace_method != PNG_INTERLACE_NONE) ||
+          (ihdr.compression_method != PNG_COMPRESSION_ZLIB))
+      {
+         return error("unsupported format in IHDR");
+      }
+
+      colour_type = ihdr.colour_type;
+      width       = ihdr.width;
+      height      = ihdr.height;
+      bit_depth   = ihdr.bit_depth;
+
+      unsigned samples;
+
+      switch(colour_type)
+      {
+      case PNG_COLOUR_GREY:       samples = 1; break;
+      case PNG_COLOUR_RGB:        samples = 3; break;
+      case PNG_COLOUR_INDEXED:    samples = 1; break;
+      case PNG_COLOUR_GREY_ALPHA: samples = 2; break;
+      case PNG_COLOUR_RGB_ALPHA:  samples = 4; break;
+
+      default:
+         return error("unsupported colour type");
+      }
+
+      bool depth_ok = (colour_type == PNG_COLOUR_GREY)    ? (bit_depth <= 16) :
+                      (colour_type == PNG_COLOUR_INDEXED) ? (bit_depth <= 8)  :
+                                                            (bit_depth >= 8);
+
+      if (!depth_ok || ((bit_depth & (bit_depth - 1)) != 0))
+      {
+         return error("unsupported bit depth");
+      }
+
+      // Filters operate on whole bytes, rounding up for packed pixels
+      bytes_per_pixel = (samples * bit_depth + 7) / 8;
+      row_bytes       = (samples * bit_depth * width + 7) / 8;
+
+      return checkCRC(chunk);
+   }
+
+   //! Read and process the PLTE chunk
+   bool processChunkPLTE(Chunk& chunk)
+   {
+      unsigned size = chunk.getRemaining() / 3;
+
+      palette.assign(1 << bit_depth, STB::RGBA(0x00, 0x00, 0x00, 0xFF));
+
+      if (size > palette.size())
+      {
+         return error("PLTE size error");
+      }
+
+      for(unsigned index = 0; index < size; index++)
+      {
+         struct RGB
+         {
+            uint8_t red, grn, blu;
+         };
+
+         RGB entry;
+
+         if (!chunk.read(entry))
+         {
+            return error("PLTE read error");
+         }
+
+         palette[index] = STB::RGBA(entry.red, entry.grn, entry.blu, 0xFF);
+      }
+
+      return checkCRC(chunk);
+   }
+
+   //! Decode the image one scan-line at a time as the IDAT chunks are inflated
+   bool processChunkIDAT(Chunk& chunk, Target& target)
+   {
+      if ((colour_type == PNG_COLOUR_INDEXED) && palette.empty())
+      {
+         return error("missing PLTE");
+      }
+
+      if (!target.begin(width, height)) return false;
+
+      // Only the previous and current scan-lines are kept, each preceded
+      // by one pixel of zeros so the filters need no special first pixel
+      std::vector<uint8_t> buffer_a(bytes_per_pixel + row_bytes + SPARE, 0);
+      std::vector<uint8_t> buffer_b(bytes_per_pixel + row_bytes + SPARE, 0);
+
+      uint8_t* prev = &buffer_a[bytes_per_pixel];
+      uint8_t* line = &buffer_b[bytes_per_pixel];
+
+      DataStream stream{chunk};
+      STB::ZLib  zlib{&stream};
+
+      for(unsigned y = 0; y < height; y++)
+      {
+         uint8_t filter;
+
+         if ((zlib.inflate(&filter, 1) != 1) ||
+             (zlib.inflate(line, row_bytes) != row_bytes))
+         {
+            return error("image data truncated");
+         }
+
+         if (!reverseFilter(filter, line, prev))
+         {
+            return error("unexpected filter type");
+         }
+
+         buildLine(line, target.getRow(y));
+         target.endRow(y);
+
+         std::swap(prev, line);
+      }
+
+      return true;
+   }
+
+   bool checkCRC(Chunk& chunk)
+   {
+      if (!chunk.checkCRC())
+      {
+         std::string message = "CRC error in ";
+         message += chunk.getType();
+         return error(message);
+      }
+      return true;
+   }
+
+   static const unsigned SPARE = 8; //!< Bytes after a scan-line the filters may access
+
+   static const uint8_t FILTER_NONE    = 0;
+   static const uint8_t FILTER_SUB     = 1;
+   static const uint8_t FILTER_UP      = 2;
+   static const uint8_t FILTER_AVERAGE = 3;
+   static const uint8_t FILTER_PAETH   = 4;
+
+   // Vectors using the GCC/clang vector extension. These are lowered to
+   // SSE2 or NEON, both always present on x86-64 and AArch64 hosts, and to
+   // scalar code elsewhere
+   typedef uint8_t  U8x4   __attribute__((vector_size(4)));
+   typedef uint8_t  U8x16  __attribute__((vector_size(16)));
+   typedef int16_t  S16x4  __attribute__((vector_size(8)));
+   typedef uint16_t U16x4  __attribute__((vector_size(8)));
+   typedef uint32_t U32x4  __attribute__((vector_size(16)));
+
+   template <typename VEC>
+   static VEC load(const void* ptr, size_t size = sizeof(VEC))
+   {
+      VEC v{};
+      memcpy(&v, ptr, size);
+      return v;
+   }
+
+   template <typename VEC>
+   static void store(void* ptr, VEC v, size_t size = sizeof(VEC))
+   {
+      memcpy(ptr, &v, size);
+   }
+
+   //! Reverse the Sub, Average or Paeth filter for 2, 3 or 4 byte pixels
+   //
+   //! Each step handles all the bytes of one pixel in 16-bit lanes, the
+   //! Paeth predictor is chosen with masks rather than branches. A 3 byte
+   //! pixel is moved as 4 bytes, the next pixel is loaded before the extra
+   //! byte is overwritten
+   template <uint8_t FILTER, unsigned BPP>
+   void reversePixels(uint8_t* line, const uint8_t* prev)
+   {
+      const unsigned SIZE = BPP == 3 ? 4 : BPP;
+
+      S16x4 a{};
+      S16x4 c{};
+      S16x4 x = __builtin_convertvector(load<U8x4>(line, SIZE), S16x4);
+
+      for(unsigned i = 0; i < row_bytes; i += BPP)
+      {
+         S16x4 b    = __builtin_convertvector(load<U8x4>(prev + i, SIZE), S16x4);
+         S16x4 next = __builtin_convertvector(load<U8x4>(line + i + BPP, SIZE), S16x4);
+
+         if (FILTER == FILTER_SUB)
+         {
+            x += a;
+         }
+         else if (FILTER == FILTER_AVERAGE)
+         {
+            x += (a + b) >> 1;
+         }
+         else
+         {
+            S16x4 pa = b - c;
+            S16x4 pb = a - c;
+            S16x4 pc = pa + pb;
+
+            pa = (pa ^ (pa >> 15)) - (pa >> 15);
+            pb = (pb ^ (pb >> 15)) - (pb >> 15);
+            pc = (pc ^ (pc >> 15)) - (pc >> 15);
+
+            S16x4 use_a = (pa <= pb) & (pa <= pc);
+            S16x4 use_b = (pb <= pc) & ~use_a;
+
+            x += (a & use_a) | (b & use_b) | (c & ~(use_a | use_b));
+         }
+
+         a = x & 0xFF;
+         c = b;
+         x = next;
+
+         store(line + i, __builtin_convertvector(a, U8x4), SIZE);
+      }
+   }
+
+   //! Reverse the Sub, Average or Paeth filter with vectors if possible
+   template <uint8_t FILTER>
+   bool reversePixels(uint8_t* line, const uint8_t* prev)
+   {
+      switch(bytes_per_pixel)
+      {
+      case 2:
+         // Only Paeth gains from vectors with so few lanes in use
+         if (FILTER != FILTER_PAETH) return false;
+         reversePixels<FILTER, 2>(line, prev);
+         return true;
+
+      case 3: reversePixels<FILTER, 3>(line, prev); return true;
+      case 4: reversePixels<FILTER, 4>(line, prev); return true;
+      }
+
+      return false;
+   }
+
+   //! Reverse a scan-line filter
+   //
+   //! The bytes before line[0] and prev[0] for one pixel must be zero, for
+   //! the first scan-line prev must be all zero. Both need SPARE bytes
+   //! after the end of the scan-line
+   bool reverseFilter(uint8_t filter, uint8_t* line, const uint8_t* prev)
+   {
+      // Pixels one to the left on this and the previous scan-line
+      const uint8_t* left    = line - bytes_per_pixel;
+      const uint8_t* up_left = prev - bytes_per_pixel;
+
+      switch(filter)
+      {
+      case FILTER_NONE:
+         break;
+
+      case FILTER_SUB:
+         if (reversePixels<FILTER_SUB>(line, prev)) break;
+
+         for(unsigned i = 0; i < row_bytes; i++)
+         {
+            line[i] += left[i];
+         }
+         break;
+
+      case FILTER_UP:
+      {
+         unsigned i = 0;
+
+         for(; (i + sizeof(U8x16)) <= row_bytes; i += sizeof(U8x16))
+         {
+            store(line + i, load<U8x16>(line + i) + load<U8x16>(prev + i));
+         }
+
+         for(; i < row_bytes; i++)
+         {
+            line[i] += prev[i];
+         }
+      }
+      break;
+
+      case FILTER_AVERAGE:
+         if (reversePixels<FILTER_AVERAGE>(line, prev)) break;
+
+         for(unsigned i = 0; i < row_bytes; i++)
+         {
+            line[i] += (left[i] + prev[i]) / 2;
+         }
+         break;
+
+      case FILTER_PAETH:
+         if (reversePixels<FILTER_PAETH>(line, prev)) break;
+
+         for(unsigned i = 0; i < row_bytes; i++)
+         {
+            uint8_t a = left[i];
+            uint8_t b = prev[i];
+            uint8_t c = up_left[i];
+
+            signed   p  = a + b - c;
+            unsigned pa = abs(p - a);
+            unsigned pb = abs(p - b);
+            unsigned pc = abs(p - c);
+
+            if ((pa <= pb) && (pa <= pc))
+            {
+               line[i] += a;
+            }
+            else if (pb <= pc)
+            {
+               line[i] += b;
+            }
+            else
+            {
+               line[i] += c;
+            }
+         }
+         break;
+
+      default:
+         return false;
+      }
+
+      return true;
+   }
+
+   //! Extract a packed sample of less than 8 bits
+   uint8_t getPacked(const uint8_t* line, unsigned x) const
+   {
+      unsigned bit  = x * bit_depth;
+      unsigned mask = (1 << bit_depth) - 1;
+
+      return (line[bit / 8] >> (8 - bit_depth - (bit % 8))) & mask;
+   }
+
+   // The vector conversions below build four STB::Colour values at a time
+   // in 32-bit lanes. A 32-bit load at a 3-byte RGB pixel also reads the
+   // first byte of the next pixel, so a whole vector is only converted
+   // while at least one more byte remains in the scan-line
+
+   //! Convert a line of grey pixels
+   void buildLineGrey(const uint8_t* line, STB::Colour* out)
+   {
+      if (bit_depth < 8)
+      {
+         unsigned scale = 0xFF / ((1 << bit_depth) - 1);
+
+         for(unsigned x = 0; x < width; x++)
+         {
+            uint8_t level = getPacked(line, x) * scale;
+            out[x] = STB::RGBA(level, level, level, 0xFF);
+         }
+      }
+      else if (bit_depth == 8)
+      {
+         unsigned x = 0;
+
+         for(; (x + 4) <= width; x += 4)
+         {
+            U32x4 level = __builtin_convertvector(load<U8x4>(line + x), U32x4);
+
+            store(out + x, (level * 0x010101) | 0xFF000000);
+         }
+
+         for(; x < width; x++)
+         {
+            uint8_t level = line[x];
+            out[x] = STB::RGBA(level, level, level, 0xFF);
+         }
+      }
+      else
+      {
+         // XXX LS 8 bits of 16 bit samples ignored
+         for(unsigned x = 0; x < width; x++)
+         {
+            uint8_t level = line[x * 2];
+            out[x] = STB::RGBA(level, level, level, 0xFF);
+         }
+      }
+   }
+
+   //! Convert a line of RGB pixels
+   void buildLineRGB(const uint8_t* line, STB::Colour* out)
+   {
+      unsigned x = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      if (bit_depth == 8)
+      {
+         for(; ((x + 4) * 3) < row_bytes; x += 4)
+         {
+            const uint8_t* p = line + x * 3;
+
+            U32x4 rgb{load<uint32_t>(p), load<uint32_t>(p + 3),
+                      load<uint32_t>(p + 6), load<uint32_t>(p + 9)};
+
+            store(out + x, ((rgb & 0xFF) << 16) | (rgb & 0xFF00) |
+                           ((rgb >> 16) & 0xFF) | 0xFF000000);
+         }
+      }
+#endif
+
+      // XXX LS 8 bits of 16 bit samples ignored
+      unsigned step = bit_depth / 8;
+
+      for(line += x * step * 3; x < width; x++)
+      {
+         out[x] = STB::RGBA(line[0], line[step], line[step * 2], 0xFF);
+         line += step * 3;
+      }
+   }
+
+   //! Convert a line of palette indexed pixels
+   void buildLineIndexed(const uint8_t* line, STB::Colour* out)
+   {
+      if (bit_depth < 8)
+      {
+         for(unsigned x = 0; x < width; x++)
+         {
+            out[x] = palette[getPacked(line, x)];
+         }
+      }
+      else
+      {
+         for(unsigned x = 0; x < width; x++)
+         {
+            out[x] = palette[line[x]];
+         }
+      }
+   }
+
+   //! Convert a line of RGB with alpha pixels
+   void buildLineRGBA(const uint8_t* line, STB::Colour* out)
+   {
+      unsigned x = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      if (bit_depth == 8)
+      {
+         for(; (x + 4) <= width; x += 4)
+         {
+            U32x4 rgba = load<U32x4>(line + x * 4);
+
+            // Swap red and blue
+            store(out + x, ((rgba & 0xFF) << 16) | (rgba & 0xFF00FF00) |
+                           ((rgba >> 16) & 0xFF));
+         }
+      }
+#endif
+
+      // XXX LS 8 bits of 16 bit samples ignored
+      unsigned step = bit_depth / 8;
+
+      for(line += x * step * 4; x < width; x++)
+      {
+         out[x] = STB::RGBA(line[0], line[step], line[step * 2], line[step * 3]);
+         line += step * 4;
+      }
+   }
+
+   //! Convert a line of grey with alpha pixels
+   void buildLineGreyAlpha(const uint8_t* line, STB::Colour* out)
+   {
+      unsigned x = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      if (bit_depth == 8)
+      {
+         for(; (x + 4) <= width; x += 4)
+         {
+            U32x4 pixel = __builtin_convertvector(load<U16x4>(line + x * 2), U32x4);
+
+            store(out + x, ((pixel & 0xFF) * 0x010101) | ((pixel >> 8) << 24));
+         }
+      }
+#endif
+
+      // XXX LS 8 bits of 16 bit samples ignored
+      unsigned step = bit_depth / 8;
+
+      for(line += x * step * 2; x < width; x++)
+      {
+         out[x] = STB::RGBA(line[0], line[0], line[0], line[step]);
+         line += step * 2;
+      }
+   }
+
+   //! Translate an un-filtered scan-line into pixels
+   void buildLine(const uint8_t* line, STB::Colour* out)
+   {
+      switch(colour_type)
+      {
+      case PNG_COLOUR_GREY:       buildLineGrey(     line, out); break;
+      case PNG_COLOUR_RGB:        buildLineRGB(      line, out); break;
+      case PNG_COLOUR_INDEXED:    buildLineIndexed(  line, out); break;
+      case PNG_COLOUR_RGB_ALPHA:  buildLineRGBA(     line, out); break;
+      case PNG_COLOUR_GREY_ALPHA: buildLineGreyAlpha(line, out); break;
+      }
+   }
+
+   unsigned                  width{0};
+   unsigned                  height{0};
+   unsigned                  row_bytes{0};
+   uint8_t                   colour_type{0};
+   uint8_t                   bit_depth{0};
+   uint8_t                   bytes_per_pixel{1};
+   std::vector<STB::Colour>  palette{};
+};
+
+
+//! Decode into caller provided pixel storage
+class BufferTarget : public PNG::Target
+{
+public:
+   BufferTarget(STB::Colour* buffer_, unsigned pitch_, unsigned& width_, unsigned& height_)
+      : buffer(buffer_)
+      , pitch(pitch_)
+      , width(width_)
+      , height(height_)
+   {
+   }
+
+private:
+   bool begin(unsigned width_, unsigned height_) override
+   {
+      bool fits = (width_ <= width) && (height_ <= height);
+
+      width  = width_;
+      height = height_;
+
+      return fits && (buffer != nullptr);
+   }
+
+   STB::Colour* getRow(unsigned y) override
+   {
+      return (STB::Colour*)((uint8_t*)buffer + y * pitch);
+   }
+
+   STB::Colour* buffer;
+   unsigned     pitch;
+   unsigned&    width;
+   unsigned&    height;
+};
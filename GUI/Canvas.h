@@ -495,6 +495,33 @@ public:
       }
    }
 
+   //! Draw a single character through a glyph cache e.g. GUI::GlyphCache
+   //
+   //! The glyph is decoded and blended once for each colour pair, later
+   //! draws copy whole pixel rows. Unlike drawChar() the whole cell is
+   //! painted, alpha zero pixels are set to bg
+   template <typename CACHE>
+   uint32_t drawChar(CACHE& cache, STB::Colour fg, STB::Colour bg,
+                     int32_t x, int32_t y, const Font* font, uint8_t ch)
+   {
+      cache.fit(font);
+
+      return cache.drawChar(*this, fg, bg, x, y, font, ch);
+   }
+
+   //! Draw a string of text through a glyph cache
+   template <typename CACHE>
+   void drawText(CACHE& cache, STB::Colour fg, STB::Colour bg,
+                 int32_t x, int32_t y, const Font* font, const char* s)
+   {
+      assert(s);
+
+      while(*s)
+      {
+         x += drawChar(cache, fg, bg, x, y, font, *s++);
+      }
+   }
+
    //! Blit from another canvas into this canvas
    void drawImage(const Canvas& source,
                   int32_t x, int32_t y,
@@ -513,6 +540,9 @@ public:
    //! Refresh the whole canvas to the display device
    void refresh() { canvasRefresh(0, 0, size.x, size.y); }
 
+   //! Refresh a rectangular region of the canvas to the display device
+   void refresh(int32_t x1, int32_t y1, int32_t x2, int32_t y2) { canvasRefresh(x1, y1, x2, y2); }
+
    //! Quick refresh (for ePaper support)
    virtual void quickRefresh() { refresh(); }
 
@@ -530,6 +560,9 @@ public:
    //! Get pointer to underlying frame buffer
    const PLT::Image* getImage() const { return canvasGetImage(); }
 
+   //! Save as an RGB PNG file (".png" extension will be added)
+   bool savePNG(const char* name) const;
+
    //! Draw a point
    void drawPoint(STB::Colour colour, const Position& p)
    {
@@ -622,14 +655,27 @@ protected:
                            uint32_t w,     uint32_t h,
                            int32_t  src_x, int32_t  src_y)
    {
+      if((w == 0) || (h == 0)) return;
+
       assert(int32_t(src_x + w) <= source.getWidth());
       assert(int32_t(src_y + h) <= source.getHeight());
 
-      for(uint32_t u = 0; u < w; u++)
+      // Row by row, copying runs of the same colour as spans
+      for(uint32_t v = 0; v < h; v++)
       {
-         for(uint32_t v = 0; v < h; v++)
+         uint32_t    run    = 0;
+         STB::Colour colour = source.getPixel(src_x, src_y + v);
+
+         for(uint32_t u = 1; u <= w; u++)
          {
-            canvasPoint(source.getPixel(src_x + u, src_y + v), x + u, y + v);
+            STB::Colour next = u < w ? source.getPixel(src_x + u, src_y + v) : colour;
+
+            if ((u == w) || (next != colour))
+            {
+               canvasSpan(colour, x + run, y + v, x + u);
+               run    = u;
+               colour = next;
+            }
          }
       }
    }
@@ -664,10 +710,12 @@ private:
 
       uint32_t max_alpha = (1 << bpp) - 1;
 
-      if((alpha_table[0] != bg_) || (alpha_table[max_alpha] != fg_))
+      if((alpha_bpp != bpp) || (alpha_table[0] != bg_) || (alpha_table[max_alpha] != fg_))
       {
          // Not already computed
 
+         alpha_bpp = bpp;
+
          STB::ColourDecode fg(fg_);
          STB::ColourDecode bg(bg_);
 
@@ -688,6 +736,7 @@ private:
 
    Vector      size{0, 0};
    STB::Colour alpha_table[1 << LOG2_MAX_ALPHA_BPP] = {};
+   uint32_t    alpha_bpp{0};   //!< Depth alpha_table was computed for
 };
 
 } // namespace GUI
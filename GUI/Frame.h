@@ -52,12 +52,15 @@ private:
 
    virtual void canvasRefresh(int32_t x1, int32_t y1, int32_t x2, int32_t y2) override
    {
+      frame.damage(x1 < 0 ? 0 : x1, y1 < 0 ? 0 : y1,
+                   x2 < 0 ? 0 : x2, y2 < 0 ? 0 : y2);
       frame.refresh();
    }
 
    virtual void canvasClear(STB::Colour colour) override
    {
       frame.clear(colour);
+      frame.damage(0, 0, frame.getWidth(), frame.getHeight());
    }
 
    virtual void canvasPoint(STB::Colour colour, int32_t x, int32_t y) override
@@ -77,7 +80,7 @@ private:
    {
       const PLT::Image* image = source.getImage();
 
-      if(image->getHandle() == nullptr)
+      if(image == nullptr)
       {
          Canvas::canvasBlit(source, x, y, w, h, src_x, src_y);
       }
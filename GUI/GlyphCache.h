@@ -0,0 +1,190 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+//! \brief Cache of rendered character cells
+
+#pragma once
+
+#include <cstring>
+
+#include "STB/Colour.h"
+
+#include "PLT/Image.h"
+
+#include "GUI/Bitmap.h"
+#include "GUI/Font.h"
+
+namespace GUI {
+
+//! Character cells rendered once into an off-screen bitmap
+//
+//! Each entry is a complete opaque cell, background, glyph and any style,
+//! already in the native pixel format. Drawing a cached character is then
+//! a copy of whole pixel rows. The cache is direct mapped, a collision
+//! simply replaces the previous entry
+template <unsigned ENTRIES = 256>
+class GlyphCache
+{
+public:
+   static const unsigned BOLD      = 1 << 0;  //!< Glyph drawn twice, one pixel apart
+   static const unsigned UNDERLINE = 1 << 1;  //!< Line across the bottom of the glyph
+
+   GlyphCache() = default;
+
+   //! Set the size of a cell, the glyph is drawn offset_y_ pixels down
+   //
+   //! Invalidates all entries
+   void resize(unsigned cell_width_, unsigned cell_height_, unsigned offset_y_ = 0)
+   {
+      cell_width  = cell_width_;
+      cell_height = cell_height_;
+      offset_y    = offset_y_;
+
+      atlas.resize((cell_width + SLOT_GAP) * ATLAS_COLS, cell_height * ATLAS_ROWS);
+
+      clear();
+   }
+
+   //! Size the cells to a font, unless they already match
+   void fit(const Font* font_)
+   {
+      if ((cell_width != font_->getWidth()) || (cell_height != font_->getHeight()))
+         resize(font_->getWidth(), font_->getHeight());
+   }
+
+   //! Invalidate all entries
+   void clear()
+   {
+      for(unsigned i = 0; i < ENTRIES; ++i)
+         key[i].font = nullptr;
+   }
+
+   //! Draw a character cell \return width of the cell (pixels)
+   uint32_t drawChar(Canvas&     canvas_,
+                     STB::Colour fg_,
+                     STB::Colour bg_,
+                     int32_t     x_,
+                     int32_t     y_,
+                     const Font* font_,
+                     uint8_t     ch_,
+                     unsigned    style_ = 0)
+   {
+      Key      k{font_, fg_, bg_, ch_, uint8_t(style_)};
+      unsigned slot = hash(k);
+
+      int32_t src_x = (slot % ATLAS_COLS) * (cell_width + SLOT_GAP);
+      int32_t src_y = (slot / ATLAS_COLS) * cell_height;
+
+      if (not (key[slot] == k))
+      {
+         render(k, src_x, src_y);
+         key[slot] = k;
+      }
+
+      blit(canvas_, x_, y_, src_x, src_y);
+
+      return cell_width;
+   }
+
+private:
+   struct Key
+   {
+      bool operator==(const Key& other_) const
+      {
+         return (font == other_.font) && (fg == other_.fg) && (bg == other_.bg) &&
+                (ch == other_.ch) && (style == other_.style);
+      }
+
+      const Font* font{nullptr};
+      STB::Colour fg{};
+      STB::Colour bg{};
+      uint8_t     ch{};
+      uint8_t     style{};
+   };
+
+   static unsigned hash(const Key& k_)
+   {
+      uint32_t h = k_.ch;
+
+      h = h * 31 + k_.fg;
+      h = h * 31 + k_.bg;
+      h = h * 31 + k_.style;
+
+      return (h ^ (h >> 16)) % ENTRIES;
+   }
+
+   //! Render a cell into the atlas
+   void render(const Key& k_, int32_t x_, int32_t y_)
+   {
+      atlas.fillRect(k_.bg, x_, y_, x_ + cell_width, y_ + cell_height);
+
+      atlas.drawChar(k_.fg, k_.bg, x_, y_ + offset_y, k_.font, k_.ch);
+
+      // Anything drawn past the right edge of the cell lands in the gap
+      // between slots and is not copied out
+
+      if ((k_.style & BOLD) != 0)
+      {
+         atlas.drawChar(k_.fg, k_.bg, x_ + 1, y_ + offset_y, k_.font, k_.ch);
+      }
+
+      if ((k_.style & UNDERLINE) != 0)
+      {
+         int32_t y = y_ + k_.font->getHeight() - 1;
+
+         atlas.drawLine(k_.fg, x_, y, x_ + cell_width, y);
+      }
+   }
+
+   //! Copy a cell from the atlas to a canvas
+   void blit(Canvas& canvas_, int32_t x_, int32_t y_, int32_t src_x_, int32_t src_y_)
+   {
+      const PLT::Image* image     = canvas_.getImage();
+      unsigned          bits      = PLT::Image::getPixelBits();
+      bool              on_canvas = (x_ >= 0) && (x_ + int32_t(cell_width) <= canvas_.getWidth()) &&
+                                    (y_ >= 0) && (y_ + int32_t(cell_height) <= canvas_.getHeight());
+
+      if ((image != nullptr) && ((bits % 8) == 0) && on_canvas)
+      {
+         unsigned dst_pitch;
+         unsigned src_pitch;
+         uint8_t* dst = image->getStorage(dst_pitch);
+         uint8_t* src = atlas.getImage()->getStorage(src_pitch);
+
+         if ((dst != nullptr) && (src != nullptr))
+         {
+            // All images on a platform share one pixel format
+            unsigned bytes_per_pixel = bits / 8;
+            unsigned bytes           = cell_width * bytes_per_pixel;
+
+            dst += y_ * dst_pitch + x_ * bytes_per_pixel;
+            src += src_y_ * src_pitch + src_x_ * bytes_per_pixel;
+
+            for(unsigned v = 0; v < cell_height; ++v)
+            {
+               memcpy(dst, src, bytes);
+               dst += dst_pitch;
+               src += src_pitch;
+            }
+
+            return;
+         }
+      }
+
+      canvas_.drawImage(atlas, x_, y_, cell_width, cell_height, src_x_, src_y_);
+   }
+
+   static const unsigned ATLAS_COLS = 16;
+   static const unsigned ATLAS_ROWS = (ENTRIES + ATLAS_COLS - 1) / ATLAS_COLS;
+   static const unsigned SLOT_GAP   = 2;   //!< Spare columns for bold and underline overrun
+
+   unsigned cell_width{0};
+   unsigned cell_height{0};
+   unsigned offset_y{0};
+   Bitmap   atlas;
+   Key      key[ENTRIES];
+};
+
+} // namespace GUI
@@ -0,0 +1,142 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <vector>
+
+#include "MTL/CanvasRGB565.h"
+
+#include "STB/Test.h"
+
+//! Stand-in for an LCD driver that records each transfer
+class MockDisplay
+{
+public:
+   struct Transfer
+   {
+      unsigned x1, y1, x2, y2;
+      unsigned pixels;
+   };
+
+   static constexpr unsigned getWidth() { return 320; }
+   static constexpr unsigned getStride() { return 320; }
+   static constexpr unsigned getHeight() { return 240; }
+
+   void display(const uint16_t* buffer_,
+                unsigned        x1_,
+                unsigned        y1_,
+                unsigned        x2_,
+                unsigned        y2_)
+   {
+      EXPECT_TRUE(x1_ < x2_);
+      EXPECT_TRUE(y1_ < y2_);
+      EXPECT_TRUE(x2_ <= getWidth());
+      EXPECT_TRUE(y2_ <= getHeight());
+
+      transfer.push_back({x1_, y1_, x2_, y2_, (x2_ - x1_) * (y2_ - y1_)});
+
+      last = buffer_[y1_ * getStride() + x1_];
+   }
+
+   std::vector<Transfer> transfer;
+   uint16_t              last{0};
+};
+
+using Canvas = MTL::CanvasRGB565<MockDisplay>;
+
+TEST(MTL_CanvasRGB565, first_refresh_is_full)
+{
+   Canvas canvas;
+
+   canvas.refresh();
+
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+   EXPECT_EQ(320u * 240u, canvas.hw.transfer[0].pixels);
+
+   // Nothing has changed
+   canvas.refresh();
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+}
+
+TEST(MTL_CanvasRGB565, small_update)
+{
+   Canvas canvas;
+
+   canvas.refresh();
+   canvas.hw.transfer.clear();
+
+   canvas.fillRect(STB::RED, 100, 50, 110, 54);
+   canvas.refresh();
+
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+
+   const MockDisplay::Transfer& t = canvas.hw.transfer[0];
+
+   EXPECT_EQ(100u, t.x1);
+   EXPECT_EQ(50u,  t.y1);
+   EXPECT_EQ(110u, t.x2);
+   EXPECT_EQ(54u,  t.y2);
+   EXPECT_EQ(40u,  t.pixels);
+   EXPECT_EQ(0xF800, canvas.hw.last);
+}
+
+TEST(MTL_CanvasRGB565, points_merge)
+{
+   Canvas canvas;
+
+   canvas.refresh();
+   canvas.hw.transfer.clear();
+
+   canvas.drawPoint(STB::WHITE, 10, 20);
+   canvas.drawPoint(STB::WHITE, 30, 5);
+   canvas.refresh();
+
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+
+   const MockDisplay::Transfer& t = canvas.hw.transfer[0];
+
+   EXPECT_EQ(10u, t.x1);
+   EXPECT_EQ(5u,  t.y1);
+   EXPECT_EQ(31u, t.x2);
+   EXPECT_EQ(21u, t.y2);
+}
+
+TEST(MTL_CanvasRGB565, partial_refresh)
+{
+   Canvas canvas;
+
+   canvas.refresh();
+   canvas.hw.transfer.clear();
+
+   canvas.fillRect(STB::BLUE, 0, 0, 8, 8);
+   canvas.fillRect(STB::BLUE, 200, 100, 208, 108);
+
+   // Only the requested part of the dirty region is sent
+   canvas.refresh(0, 0, 16, 16);
+
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+   EXPECT_EQ(16u * 16u, canvas.hw.transfer[0].pixels);
+
+   // The rest is still dirty
+   canvas.refresh();
+
+   EXPECT_EQ(2u, canvas.hw.transfer.size());
+   EXPECT_EQ(208u, canvas.hw.transfer[1].x2);
+   EXPECT_EQ(108u, canvas.hw.transfer[1].y2);
+
+   canvas.refresh();
+   EXPECT_EQ(2u, canvas.hw.transfer.size());
+}
+
+TEST(MTL_CanvasRGB565, clipped_request)
+{
+   Canvas canvas;
+
+   canvas.refresh(-10, -10, 1000, 1000);
+
+   EXPECT_EQ(1u, canvas.hw.transfer.size());
+   EXPECT_EQ(320u * 240u, canvas.hw.transfer[0].pixels);
+}
+
+TEST_MAIN
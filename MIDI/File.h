@@ -14,6 +14,7 @@
 
 #include "STB/Endian.h"
 #include "MIDI/Decoder.h"
+#include "MIDI/Scheduler.h"
 
 namespace MIDI {
 
@@ -148,6 +149,57 @@ public:
       return true;
    }
 
+   //! Queue the channel messages of a track before tick until_ on a scheduler
+   //
+   //! Start the track with getTrackData() and decoder->resetState(). Tick t
+   //! is scheduled at sample origin_ + t * samples_per_tick_. Call again with
+   //! a later until_ to continue.
+   //! \return false at the end of the track
+   template <unsigned LOG2_SIZE>
+   bool scheduleTrack(Decoder*              decoder,
+                      TrackPtr*             tp,
+                      uint32_t              until_,
+                      Scheduler<LOG2_SIZE>& scheduler_,
+                      uint32_t              origin_,
+                      double                samples_per_tick_)
+   {
+      while(tp->isPlaying() && not scheduler_.full())
+      {
+         uint32_t delta_t;
+         Decoder::decodeVarLength(tp->ptr, delta_t);
+
+         if ((decoder->getTime() + delta_t) >= until_)
+            return true;
+
+         tp->ptr += decoder->decodeDeltaT(tp->ptr);
+
+         const uint8_t* msg = tp->ptr;
+
+         tp->ptr += decoder->decode(tp->ptr, tp->getSizeLeft());
+
+         uint8_t status = decoder->getState().command;
+
+         if (status < SYSTEM)
+         {
+            // Skip the status byte unless this is running status
+            const uint8_t* data = (msg[0] & 0x80) != 0 ? msg + 1 : msg;
+
+            uint8_t type      = status & 0xF0;
+            bool    short_msg = (type == PROGRAM_CHANGE) || (type == CHANNEL_PRESSURE);
+
+            Event event;
+            event.time   = origin_ + uint32_t(decoder->getTime() * samples_per_tick_);
+            event.status = status;
+            event.data1  = data[0];
+            event.data2  = short_msg ? 0 : data[1];
+
+            scheduler_.post(event);
+         }
+      }
+
+      return tp->isPlaying();
+   }
+
 private:
    //! The header for a MIDI file chunk
    //  Should only be used to decode a MIDI file that is stored in a single contiguous
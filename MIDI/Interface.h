@@ -93,17 +93,72 @@ public:
                // Instrument command
                chan = byte & 0xF;
 
-               channelCommand(chan, cmd, rx());
+               channelCommand(rx());
             }
          }
          else
          {
             // Repeat last channel command
-            channelCommand(chan, cmd, byte);
+            channelCommand(byte);
          }
       }
    }
 
+   //! Apply a complete channel message to the attached instruments
+   void dispatch(uint8_t status_, uint8_t data1_, uint8_t data2_)
+   {
+      unsigned          chan = status_ & 0xF;
+      MIDI::Instrument* inst = inst_map[chan];
+
+      switch(status_ >> 4)
+      {
+      case CMD_NOTE_ON:
+         if (debug) printf("CH%u NOTE OFF %3u %3u\n", chan + 1, data1_, data2_);
+         if (inst != nullptr)
+            inst->noteOff(chan, data1_, data2_);
+         break;
+
+      case CMD_NOTE_OFF:
+         if (debug) printf("CH%u NOTE ON  %3u %3u\n", chan + 1, data1_, data2_);
+         if (inst != nullptr)
+            inst->noteOn(chan, data1_, data2_);
+         break;
+
+      case CMD_NOTE_PRESSURE:
+         if (debug) printf("CH%u NOTE PRE %3u %3u\n", chan + 1, data1_, data2_);
+         if (inst != nullptr)
+            inst->notePressure(chan, data1_, data2_);
+         break;
+
+      case CMD_CONTROL:
+         if (debug) printf("CH%u CTRL     %3u %3u\n", chan + 1, data1_, data2_);
+         if (inst != nullptr)
+            inst->controlChange(chan, data1_, data2_);
+         break;
+
+      case CMD_PROGRAM:
+         if (debug) printf("CH%u PROG     %3u\n", chan + 1, data1_);
+         if (inst != nullptr)
+            inst->programChange(chan, data1_);
+         break;
+
+      case CMD_PRESSURE:
+         if (debug) printf("CH%u PRES     %3u\n", chan + 1, data1_);
+         if (inst != nullptr)
+            inst->channelPressure(chan, data1_);
+         break;
+
+      case CMD_PITCH_BEND:
+         {
+            int16_t pitch = ((data2_ << 7) | data1_) - 0x2000;
+            if (debug) printf("CH%u PTCH     %d\n", chan + 1, pitch);
+            if (inst != nullptr)
+               inst->channelPitchBend(chan, pitch);
+         }
+         break;
+      }
+   }
+
    // Implement MIDI stream in derived class
 
    //! Stream is currently empty
@@ -124,6 +179,16 @@ public:
          inst->controlChange(chan_, ctrl_, value_);
    }
 
+protected:
+   //! Handle a complete channel message as it is received
+   //
+   //! Applied immediately by default. Override to defer, e.g. to a
+   //! MIDI::Scheduler so that it is applied at a sample accurate time
+   virtual void channelMessage(uint8_t status_, uint8_t data1_, uint8_t data2_)
+   {
+      dispatch(status_, data1_, data2_);
+   }
+
 private:
    //! Broadcast SYSEX byte
    void sysexCommand(uint8_t byte)
@@ -143,81 +208,15 @@ private:
       }
    }
 
-   void channelCommand(unsigned chan, unsigned cmd, uint8_t byte)
+   //! Gather the remaining data bytes of a channel message
+   void channelCommand(uint8_t data1_)
    {
-      MIDI::Instrument* inst = inst_map[chan];
-
-      switch(cmd)
-      {
-      case CMD_NOTE_ON:
-         {
-            uint8_t note     = byte;
-            uint8_t velocity = rx();
-            if (debug) printf("CH%u NOTE OFF %3u %3u\n", chan + 1, note, velocity);
-            if (inst != nullptr)
-               inst->noteOff(chan, note, velocity);
-         }
-         break;
-
-      case CMD_NOTE_OFF:
-         {
-            uint8_t note     = byte;
-            uint8_t velocity = rx();
-            if (debug) printf("CH%u NOTE ON  %3u %3u\n", chan + 1, note, velocity);
-            if (inst != nullptr)
-               inst->noteOn(chan, note, velocity);
-         }
-         break;
-
-      case CMD_NOTE_PRESSURE:
-         {
-            uint8_t note  = byte;
-            uint8_t level = rx();
-            if (debug) printf("CH%u NOTE PRE %3u %3u\n", chan + 1, note, level);
-            if (inst != nullptr)
-               inst->notePressure(chan, note, level);
-         }
-         break;
-
-      case CMD_CONTROL:
-         {
-            uint8_t ctrl  = byte;
-            uint8_t value = rx();
-            if (debug) printf("CH%u CTRL     %3u %3u\n", chan + 1, ctrl, value);
-            if (inst != nullptr)
-               inst->controlChange(chan, ctrl, value);
-         }
-         break;
-
-      case CMD_PROGRAM:
-         {
-            uint8_t prog = byte;
-            if (debug) printf("CH%u PROG     %3u\n", chan + 1, prog);
-            if (inst != nullptr)
-               inst->programChange(chan, prog);
-         }
-         break;
+      uint8_t data2 = 0;
 
-      case CMD_PRESSURE:
-         {
-            uint8_t level = byte;
-            if (debug) printf("CH%u PRES     %3u\n", chan + 1, level);
-            if (inst != nullptr)
-               inst->channelPressure(chan, level);
-         }
-         break;
+      if ((cmd != CMD_PROGRAM) && (cmd != CMD_PRESSURE))
+         data2 = rx();
 
-      case CMD_PITCH_BEND:
-         {
-            uint8_t lsb   = byte;
-            uint8_t msb   = rx();
-            int16_t pitch = ((msb << 7) | lsb) - 0x2000;
-            if (debug) printf("CH%u PTCH     %d\n", chan + 1, pitch);
-            if (inst != nullptr)
-               inst->channelPitchBend(chan, pitch);
-         }
-         break;
-      }
+      channelMessage((cmd << 4) | chan, data1_, data2);
    }
 
    static const unsigned NUM_CHAN = 16;
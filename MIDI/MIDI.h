@@ -10,3 +10,4 @@
 #include "File.h"
 #include "Instrument.h"
 #include "Interface.h"
+#include "Scheduler.h"
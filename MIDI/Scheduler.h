@@ -0,0 +1,180 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Sample accurate scheduling of MIDI channel messages into audio blocks
+//
+// Messages are stamped with a sample time as they are received and queued in
+// a lock-free ring. The audio call-back then renders its block in spans, split
+// at the sample offset of each message, so that note onsets and controller
+// steps land on the sample they were played rather than on a block boundary.
+//
+//   MIDI::Scheduler<> scheduler{SAMPLE_RATE, /* latency */ 256};
+//
+//   midi.setScheduler(&scheduler);      // receiver e.g. PLT::MIDI::Interface
+//
+//   void getSamples(int16_t* buffer, unsigned n) override
+//   {
+//      scheduler.process(n,
+//                        [&](const MIDI::Event& e_)
+//                        {
+//                           midi.dispatch(e_.status, e_.data1, e_.data2);
+//                        },
+//                        [&](unsigned offset_, unsigned n_)
+//                        {
+//                           synth.getSamples(buffer + offset_, n_);
+//                        });
+//   }
+//
+// A message received while block k is rendered is due one latency later than
+// the wall clock time since block k started. With a latency of one audio
+// block the jitter is replaced by a constant delay. Messages that are late
+// are applied at the start of the next span.
+//
+// One thread receives and one thread renders. The clock uses
+// std::chrono::steady_clock so this is for hosted platforms.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace MIDI {
+
+//! A channel message due at a sample time
+struct Event
+{
+   uint32_t time{0};   //!< Sample time
+   uint8_t  status{0};
+   uint8_t  data1{0};
+   uint8_t  data2{0};
+};
+
+template <unsigned LOG2_SIZE = 8>
+class Scheduler
+{
+public:
+   Scheduler(unsigned sample_rate_, unsigned latency_)
+      : sample_rate(sample_rate_)
+      , latency(latency_)
+   {
+      clock.store(pack(0, usec()), std::memory_order_relaxed);
+   }
+
+   //! Sample time of the start of the next block
+   uint32_t getTime() const { return time; }
+
+   //---------------------------------------------------------------------------
+   // Receiver side
+
+   //! Sample time for a message received now
+   uint32_t stamp() const
+   {
+      uint64_t packed  = clock.load(std::memory_order_acquire);
+      uint32_t start   = uint32_t(packed >> 32);
+      uint32_t elapsed = usec() - uint32_t(packed);
+
+      return start + latency + uint32_t(uint64_t(elapsed) * sample_rate / 1000000);
+   }
+
+   //! Queue a message received now
+   bool post(uint8_t status_, uint8_t data1_, uint8_t data2_)
+   {
+      return post(Event{stamp(), status_, data1_, data2_});
+   }
+
+   //! Queue a message with a known sample time
+   //
+   //! Messages must be posted in time order
+   //! \return false if the queue is full and the message was dropped
+   bool post(const Event& event_)
+   {
+      uint32_t w = write.load(std::memory_order_relaxed);
+
+      if ((w - read.load(std::memory_order_acquire)) == SIZE)
+         return false;
+
+      ring[w & MASK] = event_;
+
+      write.store(w + 1, std::memory_order_release);
+      return true;
+   }
+
+   //! Returns true if no more messages can be queued
+   bool full() const
+   {
+      return (write.load(std::memory_order_relaxed) - read.load(std::memory_order_acquire)) == SIZE;
+   }
+
+   //---------------------------------------------------------------------------
+   // Audio side
+
+   //! Render a block of n_ samples applying messages at their sample time
+   //
+   //! dispatch_(const Event&) applies a message
+   //! render_(offset, n) renders n samples from offset into the block
+   template <typename DISPATCH, typename RENDER>
+   void process(unsigned n_, DISPATCH dispatch_, RENDER render_)
+   {
+      clock.store(pack(time, usec()), std::memory_order_release);
+
+      unsigned done = 0;
+
+      for(uint32_t r = read.load(std::memory_order_relaxed);
+          r != write.load(std::memory_order_acquire);
+          ++r)
+      {
+         const Event& event = ring[r & MASK];
+
+         int32_t offset = int32_t(event.time - time);
+
+         if (offset >= int32_t(n_))
+            break;
+
+         if (offset > int32_t(done))
+         {
+            render_(done, unsigned(offset) - done);
+            done = offset;
+         }
+
+         dispatch_(event);
+
+         read.store(r + 1, std::memory_order_release);
+      }
+
+      if (done < n_)
+         render_(done, n_ - done);
+
+      time += n_;
+   }
+
+private:
+   static constexpr uint32_t SIZE = uint32_t(1) << LOG2_SIZE;
+   static constexpr uint32_t MASK = SIZE - 1;
+
+   static uint64_t pack(uint32_t time_, uint32_t usec_)
+   {
+      return (uint64_t(time_) << 32) | usec_;
+   }
+
+   //! Wall clock (uS), wraps
+   static uint32_t usec()
+   {
+      auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+      return uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+   }
+
+   const unsigned sample_rate;
+   const unsigned latency;
+
+   std::atomic<uint64_t> clock{0}; //!< Sample time and wall clock at the last block start
+   std::atomic<uint32_t> write{0};
+   std::atomic<uint32_t> read{0};
+   Event                 ring[SIZE];
+   uint32_t              time{0};  //!< Audio side
+};
+
+} // namespace MIDI
@@ -0,0 +1,262 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <vector>
+
+#include "MIDI/MIDI.h"
+
+#include "STB/Test.h"
+
+namespace {
+
+//! Record of the spans rendered and the messages applied between them
+struct Trace
+{
+   void span(unsigned offset_, unsigned n_)
+   {
+      log.push_back({'R', offset_, n_});
+   }
+
+   void event(const MIDI::Event& event_, uint32_t block_)
+   {
+      log.push_back({'E', unsigned(event_.time - block_), event_.data1});
+   }
+
+   struct Entry
+   {
+      char     type;
+      unsigned a;
+      unsigned b;
+   };
+
+   std::vector<Entry> log;
+};
+
+//! Run one block through a scheduler, recording to a trace
+template <typename SCHEDULER>
+void runBlock(SCHEDULER& scheduler_, Trace& trace_, unsigned n_)
+{
+   uint32_t block = scheduler_.getTime();
+
+   scheduler_.process(n_,
+                      [&](const MIDI::Event& e_) { trace_.event(e_, block); },
+                      [&](unsigned offset_, unsigned count_) { trace_.span(offset_, count_); });
+}
+
+//! Byte stream interface that schedules messages at a fixed time
+class TestInterface : public MIDI::Interface
+{
+public:
+   TestInterface(MIDI::Scheduler<>& scheduler_, const std::vector<uint8_t>& bytes_)
+      : scheduler(scheduler_)
+      , bytes(bytes_)
+   {}
+
+   bool empty() const override { return next == bytes.size(); }
+
+   uint8_t rx() override { return bytes[next++]; }
+
+   void tx(uint8_t) override {}
+
+   uint32_t time{0};
+
+private:
+   void channelMessage(uint8_t status_, uint8_t data1_, uint8_t data2_) override
+   {
+      scheduler.post(MIDI::Event{time, status_, data1_, data2_});
+   }
+
+   MIDI::Scheduler<>&   scheduler;
+   std::vector<uint8_t> bytes;
+   size_t               next{0};
+};
+
+class TestInstrument : public MIDI::Instrument
+{
+public:
+   TestInstrument() : MIDI::Instrument(4) {}
+
+   void voiceOn(unsigned voice_, uint8_t note_, uint8_t velocity_) override
+   {
+      notes.push_back(note_);
+   }
+
+   void voiceControl(unsigned voice_, uint8_t control_, uint8_t value_) override
+   {
+      value = value_;
+   }
+
+   std::vector<uint8_t> notes;
+   uint8_t              value{0};
+};
+
+}
+
+TEST(MIDI_Scheduler, split_block)
+{
+   MIDI::Scheduler<> scheduler{48000, 64};
+   Trace             trace;
+
+   scheduler.post(MIDI::Event{10, 0x90, 1, 100});
+   scheduler.post(MIDI::Event{10, 0x90, 2, 100});
+   scheduler.post(MIDI::Event{40, 0x90, 3, 100});
+   scheduler.post(MIDI::Event{70, 0x90, 4, 100});
+
+   runBlock(scheduler, trace, 64);
+
+   EXPECT_EQ(6u, trace.log.size());
+
+   EXPECT_EQ('R', trace.log[0].type); EXPECT_EQ(0u,  trace.log[0].a); EXPECT_EQ(10u, trace.log[0].b);
+   EXPECT_EQ('E', trace.log[1].type); EXPECT_EQ(10u, trace.log[1].a); EXPECT_EQ(1u,  trace.log[1].b);
+   EXPECT_EQ('E', trace.log[2].type); EXPECT_EQ(10u, trace.log[2].a); EXPECT_EQ(2u,  trace.log[2].b);
+   EXPECT_EQ('R', trace.log[3].type); EXPECT_EQ(10u, trace.log[3].a); EXPECT_EQ(30u, trace.log[3].b);
+   EXPECT_EQ('E', trace.log[4].type); EXPECT_EQ(40u, trace.log[4].a); EXPECT_EQ(3u,  trace.log[4].b);
+   EXPECT_EQ('R', trace.log[5].type); EXPECT_EQ(40u, trace.log[5].a); EXPECT_EQ(24u, trace.log[5].b);
+
+   // Held over to the next block
+   trace.log.clear();
+   runBlock(scheduler, trace, 64);
+
+   EXPECT_EQ(3u, trace.log.size());
+   EXPECT_EQ('E', trace.log[1].type); EXPECT_EQ(6u, trace.log[1].a); EXPECT_EQ(4u, trace.log[1].b);
+}
+
+TEST(MIDI_Scheduler, late)
+{
+   MIDI::Scheduler<> scheduler{48000, 64};
+   Trace             trace;
+
+   runBlock(scheduler, trace, 64);
+
+   // Due in the block already rendered, applied at the start of this one
+   scheduler.post(MIDI::Event{20, 0xB0, 7, 64});
+
+   trace.log.clear();
+   runBlock(scheduler, trace, 64);
+
+   EXPECT_EQ(2u, trace.log.size());
+   EXPECT_EQ('E', trace.log[0].type);
+   EXPECT_EQ('R', trace.log[1].type); EXPECT_EQ(0u, trace.log[1].a); EXPECT_EQ(64u, trace.log[1].b);
+}
+
+TEST(MIDI_Scheduler, full)
+{
+   MIDI::Scheduler<2> scheduler{48000, 64};
+   Trace              trace;
+
+   for(unsigned i = 0; i < 4; ++i)
+      EXPECT_TRUE(scheduler.post(MIDI::Event{i, 0x90, uint8_t(i), 100}));
+
+   EXPECT_TRUE(scheduler.full());
+   EXPECT_FALSE(scheduler.post(MIDI::Event{5, 0x90, 5, 100}));
+
+   runBlock(scheduler, trace, 64);
+
+   EXPECT_FALSE(scheduler.full());
+}
+
+TEST(MIDI_Scheduler, stamp)
+{
+   MIDI::Scheduler<> scheduler{48000, 256};
+   Trace             trace;
+
+   runBlock(scheduler, trace, 256);
+
+   // Received while the first block is rendered, due no earlier than the next
+   EXPECT_LE(256u, scheduler.stamp());
+}
+
+TEST(MIDI_Scheduler, interface)
+{
+   MIDI::Scheduler<> scheduler{48000, 64};
+   TestInstrument    synth;
+
+   // Note on with running status then a control change
+   TestInterface midi{scheduler, {0x90, 60, 100, 64, 100, 0xB0, 1, 99}};
+
+   midi.attachInstrument(synth);
+
+   midi.time = 32;
+   midi.tick();
+
+   // Nothing is applied until the audio side runs
+   EXPECT_EQ(0u, synth.notes.size());
+
+   std::vector<unsigned> at;
+
+   scheduler.process(64,
+                     [&](const MIDI::Event& e_)
+                     {
+                        at.push_back(e_.time);
+                        midi.dispatch(e_.status, e_.data1, e_.data2);
+                     },
+                     [&](unsigned, unsigned) {});
+
+   EXPECT_EQ(3u,  at.size());
+   EXPECT_EQ(32u, at[0]);
+   EXPECT_EQ(2u,  synth.notes.size());
+   EXPECT_EQ(60,  synth.notes[0]);
+   EXPECT_EQ(64,  synth.notes[1]);
+   EXPECT_EQ(99,  synth.value);
+}
+
+TEST(MIDI_Scheduler, file)
+{
+   static const uint8_t smf[] =
+   {
+      'M', 'T', 'h', 'd', 0, 0, 0, 6,
+      0, 0,   0, 1,   0, 96,                   // format 0, 1 track, 96 ticks/beat
+      'M', 'T', 'r', 'k', 0, 0, 0, 13,
+      0x00, 0x90, 60, 100,                     // note on
+      0x60,       60, 0,                       // running status note off at tick 96
+      0x60, 0xC0, 5,                           // program change at tick 192
+      0x00, 0xFF, 0x2F, 0x00                   // end of track
+   };
+
+   const char* filename = "testScheduler.mid";
+
+   FILE* fp = fopen(filename, "wb");
+   fwrite(smf, sizeof(smf), 1, fp);
+   fclose(fp);
+
+   MIDI::File file;
+   EXPECT_TRUE(file.load(filename));
+   remove(filename);
+
+   MIDI::Scheduler<> scheduler{48000, 64};
+   MIDI::Decoder     decoder;
+   MIDI::TrackPtr    tp;
+
+   file.getTrackData(0, &tp);
+   decoder.resetState();
+
+   // 10 samples per tick, queue the first beat
+   EXPECT_TRUE(file.scheduleTrack(&decoder, &tp, 96, scheduler, 1000, 10.0));
+
+   // The rest of the track
+   EXPECT_FALSE(file.scheduleTrack(&decoder, &tp, 1000, scheduler, 1000, 10.0));
+
+   std::vector<MIDI::Event> events;
+
+   scheduler.process(4000,
+                     [&](const MIDI::Event& e_) { events.push_back(e_); },
+                     [&](unsigned, unsigned) {});
+
+   EXPECT_EQ(3u, events.size());
+
+   EXPECT_EQ(1000u, events[0].time);
+   EXPECT_EQ(0x90,  events[0].status);
+   EXPECT_EQ(60,    events[0].data1);
+   EXPECT_EQ(100,   events[0].data2);
+
+   EXPECT_EQ(1960u, events[1].time);
+   EXPECT_EQ(0x90,  events[1].status);
+   EXPECT_EQ(0,     events[1].data2);
+
+   EXPECT_EQ(2920u, events[2].time);
+   EXPECT_EQ(0xC0,  events[2].status);
+   EXPECT_EQ(5,     events[2].data1);
+}
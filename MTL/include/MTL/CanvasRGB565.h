@@ -11,6 +11,11 @@
 
 namespace MTL {
 
+//! Canvas with an RGB 565 frame buffer
+//
+//! Tracks the bounding box of pixels written since the last refresh so that
+//! only the changed region is sent to the display. DISPLAY must provide
+//! display(buffer, x1, y1, x2, y2) to transfer a window of the frame
 template <typename DISPLAY>
 class CanvasRGB565 : public GUI::Canvas
 {
@@ -23,23 +28,77 @@ public:
    DISPLAY hw{};
 
 private:
-   void canvasPoint(STB::Colour colour, int32_t x_, int32_t y_) override
+   static uint16_t toRGB565(STB::Colour colour)
    {
       unsigned red = (colour >> 19) &  0b11111;
       unsigned grn = (colour >> 10) & 0b111111;
       unsigned blu = (colour >>  3) &  0b11111;
 
-      uint16_t rgb565 = (red << 11) | (grn << 5) | blu;
+      return (red << 11) | (grn << 5) | blu;
+   }
+
+   //! Grow the dirty region to include [x1,x2) on row y
+   void markDirty(int32_t x1, int32_t y, int32_t x2)
+   {
+      if (x1 < dirty_x1) dirty_x1 = x1;
+      if (x2 > dirty_x2) dirty_x2 = x2;
+      if (y < dirty_y1)  dirty_y1 = y;
+      if (y >= dirty_y2) dirty_y2 = y + 1;
+   }
+
+   void canvasPoint(STB::Colour colour, int32_t x_, int32_t y_) override
+   {
+      frame[y_ * DISPLAY::getStride() + x_] = toRGB565(colour);
+
+      markDirty(x_, y_, x_ + 1);
+   }
+
+   void canvasSpan(STB::Colour colour, int32_t x1_, int32_t y_, int32_t x2_) override
+   {
+      if (x2_ <= x1_) return;
+
+      uint16_t  rgb565 = toRGB565(colour);
+      uint16_t* line   = &frame[y_ * DISPLAY::getStride()];
+
+      for(int32_t x = x1_; x < x2_; ++x)
+         line[x] = rgb565;
 
-      frame[y_ * DISPLAY::getStride() + x_] = rgb565;
+      markDirty(x1_, y_, x2_);
    }
 
    void canvasRefresh(int32_t x1, int32_t y1, int32_t x2, int32_t y2) override
    {
-      hw.display(frame);
+      // Only the dirty part of the requested region needs sending
+      bool covers_dirty = (x1 <= dirty_x1) && (y1 <= dirty_y1) &&
+                          (x2 >= dirty_x2) && (y2 >= dirty_y2);
+
+      if (x1 < dirty_x1) x1 = dirty_x1;
+      if (y1 < dirty_y1) y1 = dirty_y1;
+      if (x2 > dirty_x2) x2 = dirty_x2;
+      if (y2 > dirty_y2) y2 = dirty_y2;
+
+      if ((x1 < x2) && (y1 < y2))
+      {
+         hw.display(frame, x1, y1, x2, y2);
+      }
+
+      // Any dirty pixels outside the request are kept for a later refresh
+      if (covers_dirty)
+      {
+         dirty_x1 = getWidth();
+         dirty_y1 = getHeight();
+         dirty_x2 = 0;
+         dirty_y2 = 0;
+      }
    }
 
    uint16_t frame[DISPLAY::getStride() * DISPLAY::getHeight()];
+
+   // Dirty region, initially the whole frame as the display content is unknown
+   int32_t dirty_x1{0};
+   int32_t dirty_y1{0};
+   int32_t dirty_x2{DISPLAY::getWidth()};
+   int32_t dirty_y2{DISPLAY::getHeight()};
 };
 
 } // namespace MTL
@@ -18,16 +18,20 @@
 
 #include "MTL/chip/Gpio.h"
 #include "MTL/chip/Pwm.h"
+#include "MTL/chip/Pio.h"
 #include "MTL/chip/Pio8080.h"
 
 namespace MTL {
 
+//! When USE_PIO is set bytes are written through a PIO state machine driving
+//! the data bus and WR strobe, otherwise the bus is driven directly from GPIO
 template <unsigned PIN_CS,
           unsigned PIN_DC,
           unsigned PIN_WR,
           unsigned PIN_RD,
           unsigned PIN_DB,
-          unsigned PIN_BL>
+          unsigned PIN_BL,
+          bool     USE_PIO = false>
 class Lcd_ST7789V
 {
 public:
@@ -44,9 +48,6 @@ public:
 
    Lcd_ST7789V()
    {
-      // Pio0 pio;
-      // pio_wr.download(pio, 1000000, PIN_DB, PIN_WR);
-
       out_cs = 1;
       out_dc = 1;
       out_wr = 1;
@@ -54,6 +55,14 @@ public:
       out_db = 0;
       out_bl = 0;
 
+      if (USE_PIO)
+      {
+         // Hand the data bus and WR strobe over to the PIO
+         sd_wr = pio_wr.download(pio, PIO_FREQ, PIN_DB, PIN_WR);
+         if (sd_wr >= 0)
+            pio.start(1 << sd_wr);
+      }
+
       setupRegs();
 
       setBrightness(128);
@@ -102,6 +111,8 @@ public:
 
    void clear(uint16_t rgb_ = 0x0000)
    {
+      setWindow(0, 0, WIDTH, HEIGHT);
+
       command0(RAMWR);
 
       out_cs = 0;
@@ -112,21 +123,43 @@ public:
          write(rgb_ & 0xFF);
       }
 
+      flush();
+
       out_cs = 1;
    }
 
+   //! Send the whole frame
    void display(const uint16_t* buffer_)
    {
+      display(buffer_, 0, 0, WIDTH, HEIGHT);
+   }
+
+   //! Send the region [x1,x2) x [y1,y2) of a frame with a stride of WIDTH
+   void display(const uint16_t* buffer_,
+                unsigned        x1_,
+                unsigned        y1_,
+                unsigned        x2_,
+                unsigned        y2_)
+   {
+      setWindow(x1_, y1_, x2_, y2_);
+
       command0(RAMWR);
 
       out_cs = 0;
 
-      for(unsigned i = 0; i < WIDTH * HEIGHT; ++i)
+      for(unsigned y = y1_; y < y2_; ++y)
       {
-         write(buffer_[i] >> 8);
-         write(buffer_[i] & 0xFF);
+         const uint16_t* line = buffer_ + y * WIDTH;
+
+         for(unsigned x = x1_; x < x2_; ++x)
+         {
+            write(line[x] >> 8);
+            write(line[x] & 0xFF);
+         }
       }
 
+      flush();
+
       out_cs = 1;
    }
 
@@ -137,9 +170,36 @@ private:
    //! Write a single byte
    void write(uint8_t data)
    {
-      out_wr = 0;
-      out_db = data;
-      out_wr = 1;
+      if (USE_PIO && (sd_wr >= 0))
+      {
+         pio.SM_push(sd_wr, uint32_t(data) << 24);
+      }
+      else
+      {
+         out_wr = 0;
+         out_db = data;
+         out_wr = 1;
+      }
+   }
+
+   //! Wait for all written bytes to reach the bus
+   void flush()
+   {
+      if (USE_PIO && (sd_wr >= 0))
+      {
+         pio.SM_waitTxStall(sd_wr);
+      }
+   }
+
+   //! Set the frame memory window for following RAMWR data
+   void setWindow(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+   {
+      // End addresses are inclusive
+      --x2;
+      --y2;
+
+      command4(CASET, x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF);
+      command4(RASET, y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF);
    }
 
    //! Write a command with one parameters
@@ -150,11 +210,15 @@ private:
 
       write(cmd);
 
+      flush();
+
       out_dc = 1;
 
       for(unsigned i = 0; i < n; ++i)
          write(byte[i]);
 
+      flush();
+
       out_cs = 1;
    }
 
@@ -251,18 +315,7 @@ private:
 
       usleep(150000);
 
-      uint16_t       word_pair[2];
-      const uint8_t* b = (uint8_t*)word_pair;
-
-      // Column address set
-      word_pair[0] = 0;
-      word_pair[1] = WIDTH - 1;
-      command4(CASET, b[1], b[0], b[3], b[2]);
-
-      // Row address set
-      word_pair[0] = 0;
-      word_pair[1] = HEIGHT - 1;
-      command4(RASET, b[1], b[0], b[3], b[2]);
+      setWindow(0, 0, WIDTH, HEIGHT);
 
       // Memory Data Access control
       const uint8_t MADCTL_MY  = 0b10000000;
@@ -306,6 +359,8 @@ private:
    static const uint8_t NVGAMCTRL = 0xE0;
    static const uint8_t DGMLUTR   = 0xE1;
 
+   static const unsigned PIO_FREQ = 24000000; //!< Two PIO cycles per byte
+
    Gpio::Out<1,PIN_CS> out_cs{}; // Chip Select
    Gpio::Out<1,PIN_DC> out_dc{}; // Data not Command
    Gpio::Out<1,PIN_WR> out_wr{}; // Write
@@ -313,6 +368,8 @@ private:
    Gpio::Out<8,PIN_DB> out_db{}; // Data byte
    Pwm<PIN_BL>         out_bl{}; // Back-light
    Pio8080             pio_wr{};
+   Pio0                pio{};
+   signed              sd_wr{-1};
 };
 
 } // namespace MTL
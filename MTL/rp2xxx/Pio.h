@@ -265,6 +265,15 @@ public:
       this->reg->txf[sd] = data;
    }
 
+   //! Wait until the TX FIFO has drained and the state machine is stalled on a pull
+   void SM_waitTxStall(unsigned sd) const
+   {
+      // Clear the sticky TXSTALL flag and wait for it to be set again
+      this->reg->fdebug = 1 << (24 + sd);
+
+      while(this->getBit(this->reg->fdebug, 24 + sd) == 0);
+   }
+
    //! Pop data from RX FIFO
    uint32_t SM_pop(unsigned sd)
    {
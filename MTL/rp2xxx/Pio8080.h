@@ -46,6 +46,9 @@ public:
       pio.SM_pinOUT( sd, pin_db, 8);
       pio.SM_pinSIDE(sd, pin_wr);
 
+      // Bytes are taken from the MS end of each word pushed
+      pio.SM_configOSR(sd, 8, SHIFT_LEFT, AUTO_PULL, /* join_tx */ true);
+
       return sd;
    }
 };
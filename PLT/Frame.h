@@ -25,6 +25,7 @@ public:
    static const uint32_t RESIZABLE   = 1 << 0; //!< Frame can be resized
    static const uint32_t NO_BORDER   = 1 << 1; //!< Frame has no external border pixels
    static const uint32_t FULL_SCREEN = 1 << 2; //!< Frame should cover the whole screen
+   static const uint32_t VSYNC       = 1 << 3; //!< Pace refresh() with the display
 
    // Hints to request a logical pixel size larger than physical pixel size
    static uint32_t SCALE_X(unsigned n) { return ((n - 1) & 0xF) << 4; }
@@ -114,8 +115,17 @@ public:
    void resize(unsigned width_, unsigned height_);
 
    //! Ensure any changes to the frame buffer are displayed
+   //
+   //! When regions have been marked with damage() only those are updated,
+   //! otherwise the whole frame buffer is
    void refresh();
 
+   //! Mark a region of the frame buffer as changed since the last refresh()
+   //
+   //! \param x1,y1 top left (pixels)
+   //! \param x2,y2 bottom right, exclusive (pixels)
+   void damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2);
+
    //! Add a pixel generator
    void setGenerator(Generator* generator_);
 
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Headless Event implementation, replays events queued by PLT::Headless
+
+#include "PLT/Event.h"
+
+#include "Headless.h"
+
+namespace PLT {
+
+namespace Event {
+
+Type poll(Message& event)
+{
+   if (not Headless::internal_popEvent(event))
+   {
+      // End of the script
+      event      = Message{};
+      event.type = QUIT;
+   }
+
+   return event.type;
+}
+
+Type wait(Message& event)
+{
+   return poll(event);
+}
+
+int mainLoop(bool (*callback)(void*), void* user_data)
+{
+   if (callback != nullptr)
+   {
+      while((*callback)(user_data)) {}
+   }
+
+   return 0;
+}
+
+int eventLoop(void (*callback)(const Message&, void*), void* user_data)
+{
+   Message event;
+
+   while(true)
+   {
+      Type type = wait(event);
+
+      if (callback != nullptr) (*callback)(event, user_data);
+
+      if (type == QUIT) break;
+   }
+
+   return 0;
+}
+
+void setTimer(unsigned period_ms)
+{
+   // Time is not simulated, TIMER events are queued like any other
+}
+
+} // namespace Event
+
+} // namespace PLT
@@ -0,0 +1,168 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Headless Frame implementation, a 32-bit frame buffer in memory
+
+#include <string>
+#include <vector>
+
+#include "PLT/Frame.h"
+
+#include "Headless.h"
+
+namespace PLT {
+
+class Frame::Impl
+{
+public:
+   Impl(const char* title_, uint32_t flags_)
+      : title(title_)
+      , flags(flags_)
+      , id(++next_id)
+   {
+   }
+
+   uint8_t* getStorage(unsigned& pitch)
+   {
+      pitch = width * 4;
+      return pixels.empty() ? nullptr : pixels.data();
+   }
+
+   uint32_t getId() const { return id; }
+
+   void setTitle(const char* title_) { title = title_; }
+
+   void setFlags(uint32_t flags_) { flags = flags_; }
+
+   void resize(unsigned width_, unsigned height_)
+   {
+      width  = width_;
+      height = height_;
+
+      pixels.assign(width * height * 4, 0);
+
+      dirty = false;
+   }
+
+   void refresh(const Frame& frame)
+   {
+      if (dirty)
+      {
+         Headless::internal_refresh(frame, dirty_x1, dirty_y1, dirty_x2, dirty_y2);
+         dirty = false;
+      }
+      else
+      {
+         Headless::internal_refresh(frame, 0, 0, width, height);
+      }
+   }
+
+   void damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+   {
+      if (x2 > width)  x2 = width;
+      if (y2 > height) y2 = height;
+      if ((x1 >= x2) || (y1 >= y2)) return;
+
+      if (not dirty)
+      {
+         dirty_x1 = x1;
+         dirty_y1 = y1;
+         dirty_x2 = x2;
+         dirty_y2 = y2;
+         dirty    = true;
+         return;
+      }
+
+      // Only the bounding region is tracked
+      if (x1 < dirty_x1) dirty_x1 = x1;
+      if (y1 < dirty_y1) dirty_y1 = y1;
+      if (x2 > dirty_x2) dirty_x2 = x2;
+      if (y2 > dirty_y2) dirty_y2 = y2;
+   }
+
+private:
+   static uint32_t next_id;
+
+   std::string          title;
+   uint32_t             flags;
+   uint32_t             id;
+   unsigned             width{0};
+   unsigned             height{0};
+   std::vector<uint8_t> pixels;
+   bool                 dirty{false};  //!< false implies the whole frame on refresh()
+   unsigned             dirty_x1{0};
+   unsigned             dirty_y1{0};
+   unsigned             dirty_x2{0};
+   unsigned             dirty_y2{0};
+};
+
+uint32_t Frame::Impl::next_id = 0;
+
+
+Frame::Frame(const char* title_, unsigned width_, unsigned height_, uint32_t flags_)
+   : Image(width_, height_)
+{
+   pimpl = new Impl(title_, flags_);
+   pimpl->resize(width, height);
+   buffer = pimpl->getStorage(pitch);
+}
+
+Frame::~Frame() { delete pimpl; }
+
+void* Frame::getHandle() const
+{
+   // No acceleration possible
+   return nullptr;
+}
+
+uint32_t Frame::getId() const
+{
+   return pimpl->getId();
+}
+
+void Frame::setTitle(const char* title_)
+{
+   pimpl->setTitle(title_);
+}
+
+void Frame::setFlags(uint32_t flags_)
+{
+   pimpl->setFlags(flags_);
+}
+
+void Frame::setVisible(bool visible_)
+{
+}
+
+void Frame::resize(unsigned width_, unsigned height_)
+{
+   if((width == width_) && (height == height_)) return;
+
+   width  = width_;
+   height = height_;
+
+   pimpl->resize(width_, height_);
+   buffer = pimpl->getStorage(pitch);
+}
+
+void Frame::refresh()
+{
+   pimpl->refresh(*this);
+}
+
+void Frame::damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+{
+   pimpl->damage(x1, y1, x2, y2);
+}
+
+void Frame::setGenerator(Generator* generator_)
+{
+}
+
+void Frame::internal_transEventXyToPixel(uint16_t& x, uint16_t& y)
+{
+}
+
+} // namespace PLT
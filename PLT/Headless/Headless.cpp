@@ -0,0 +1,107 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Headless input queue, refresh statistics and timing
+
+#include <chrono>
+#include <deque>
+
+#include "Headless.h"
+
+namespace PLT {
+
+namespace Headless {
+
+static std::deque<Event::Message> queue;
+static Stats                      stats;
+static RefreshHook                refresh_hook      = nullptr;
+static void*                      refresh_user_data = nullptr;
+
+void pushEvent(const Event::Message& event)
+{
+   queue.push_back(event);
+}
+
+void pushKey(uint8_t code)
+{
+   Event::Message event;
+
+   event.code = code;
+
+   event.type = Event::KEY_DOWN;
+   pushEvent(event);
+
+   event.type = Event::KEY_UP;
+   pushEvent(event);
+}
+
+void pushText(const char* text)
+{
+   for(const char* s = text; *s != '\0'; ++s)
+   {
+      pushKey(uint8_t(*s));
+   }
+}
+
+void clearEvents()
+{
+   queue.clear();
+}
+
+unsigned getPendingEvents()
+{
+   return queue.size();
+}
+
+void setRefreshHook(RefreshHook hook, void* user_data)
+{
+   refresh_hook      = hook;
+   refresh_user_data = user_data;
+}
+
+const Stats& getStats()
+{
+   return stats;
+}
+
+void resetStats()
+{
+   stats = Stats{};
+}
+
+uint64_t getMicroseconds()
+{
+   auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+   return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+void internal_refresh(const Frame& frame,
+                      unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+{
+   stats.refreshes++;
+   stats.refresh_pixels += uint64_t(x2 - x1) * (y2 - y1);
+
+   if (refresh_hook != nullptr)
+   {
+      (*refresh_hook)(frame, x1, y1, x2, y2, refresh_user_data);
+   }
+}
+
+bool internal_popEvent(Event::Message& event)
+{
+   if (queue.empty()) return false;
+
+   event = queue.front();
+   queue.pop_front();
+
+   stats.events++;
+
+   return true;
+}
+
+} // namespace Headless
+
+} // namespace PLT
@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+//! \file Headless.h
+//! \brief Controls for the headless in-memory platform implementation
+
+#pragma once
+
+#include <cstdint>
+
+#include "PLT/Event.h"
+#include "PLT/Frame.h"
+
+//! Platform abstraction layer
+namespace PLT {
+
+//! Script input and observe output when there is no display
+//
+//! Events are replayed from a queue. Once the queue is empty
+//! PLT::Event::poll() and PLT::Event::wait() return QUIT
+namespace Headless {
+
+//! Counters accumulated by the headless platform
+struct Stats
+{
+   uint64_t refreshes{0};       //!< Calls to PLT::Frame::refresh()
+   uint64_t refresh_pixels{0};  //!< Pixels that would have been presented
+   uint64_t events{0};          //!< Events delivered from the queue
+};
+
+//! Call-back for each PLT::Frame::refresh()
+//
+//! \param frame frame being refreshed
+//! \param x1,y1,x2,y2 bounds of the damaged region (pixels)
+//! \param user_data as passed to setRefreshHook()
+using RefreshHook = void (*)(const Frame& frame,
+                             unsigned x1, unsigned y1, unsigned x2, unsigned y2,
+                             void* user_data);
+
+//! Add an event to the end of the input queue
+void pushEvent(const Event::Message& event);
+
+//! Add a key press and release to the end of the input queue
+void pushKey(uint8_t code);
+
+//! Add a key press and release for each character in a string
+void pushText(const char* text);
+
+//! Discard all queued events
+void clearEvents();
+
+//! Number of events waiting in the input queue
+unsigned getPendingEvents();
+
+//! Install a call-back for each PLT::Frame::refresh(), nullptr to remove
+void setRefreshHook(RefreshHook hook, void* user_data = nullptr);
+
+//! Get counters accumulated since the last resetStats()
+const Stats& getStats();
+
+//! Clear accumulated counters
+void resetStats();
+
+//! Monotonic clock for timing measurements (micro-seconds)
+uint64_t getMicroseconds();
+
+//! Record a refresh of a region of a frame
+//  For internal use by the headless PLT::Frame implementation
+void internal_refresh(const Frame& frame,
+                      unsigned x1, unsigned y1, unsigned x2, unsigned y2);
+
+//! Remove the event at the front of the input queue
+//  For internal use by the headless PLT::Event implementation
+bool internal_popEvent(Event::Message& event);
+
+} // namespace Headless
+
+} // namespace PLT
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Headless Image implementation, 32-bit pixels in memory
+
+#include <algorithm>
+#include <cstring>
+
+#include "PLT/Image.h"
+
+namespace PLT {
+
+unsigned Image::getPixelBits() { return 32; }
+
+uint32_t Image::getPixel(unsigned x, unsigned y) const
+{
+   uint32_t* pixels = reinterpret_cast<uint32_t*>(buffer);
+   return pixels[x + y * pitch / 4];
+}
+
+void Image::clear(STB::Colour rgb)
+{
+   if (buffer == nullptr) return;
+
+   for(unsigned y = 0; y < height; y++)
+   {
+      uint32_t* line = reinterpret_cast<uint32_t*>(buffer + y * pitch);
+
+      std::fill_n(line, width, rgb);
+   }
+}
+
+void Image::point(STB::Colour rgb, unsigned x, unsigned y)
+{
+   uint32_t* pixels = reinterpret_cast<uint32_t*>(buffer);
+   pixels[x + y * pitch / 4] = rgb;
+}
+
+void Image::span(uint32_t rgb, unsigned x1, unsigned y, unsigned x2)
+{
+   if (x2 <= x1) return;
+
+   uint32_t* line = reinterpret_cast<uint32_t*>(buffer + y * pitch);
+
+   std::fill_n(line + x1, x2 - x1, rgb);
+}
+
+void Image::blit(const Image& source,
+                 unsigned x, unsigned y,
+                 unsigned w, unsigned h,
+                 unsigned src_x, unsigned src_y)
+{
+   unsigned       src_pitch;
+   const uint8_t* src_buffer = source.getStorage(src_pitch);
+
+   if ((src_buffer == nullptr) || (buffer == nullptr))
+   {
+      defaultBlit(source, x, y, w, h, src_x, src_y);
+      return;
+   }
+
+   if ((x >= width) || (y >= height) ||
+       (src_x >= source.getWidth()) || (src_y >= source.getHeight()))
+   {
+      return;
+   }
+
+   w = std::min({w, width - x, source.getWidth() - src_x});
+   h = std::min({h, height - y, source.getHeight() - src_y});
+
+   const uint8_t* from = src_buffer + src_y * src_pitch + src_x * 4;
+   uint8_t*       to   = buffer + y * pitch + x * 4;
+
+   if ((from < to) && (src_buffer == buffer))
+   {
+      // Overlapping copy down an image, work from the bottom up
+      for(unsigned v = h; v-- > 0; )
+      {
+         memmove(to + v * pitch, from + v * src_pitch, w * 4);
+      }
+   }
+   else
+   {
+      for(unsigned v = 0; v < h; v++)
+      {
+         memmove(to + v * pitch, from + v * src_pitch, w * 4);
+      }
+   }
+}
+
+void Image::lineBlit(uint8_t pixel_mask, STB::Colour one, STB::Colour zero,
+                     unsigned x, unsigned y)
+{
+   defaultLineBlit(pixel_mask, one, zero, x, y);
+}
+
+bool Image::save(const char* name) const
+{
+   return defaultSave(name);
+}
+
+} // namespace PLT
@@ -144,29 +144,39 @@ protected:
       }
    }
 
-   //! Write image as PPM format file
+   //! Write image as binary PPM format file
    bool defaultSave(const char* name) const
    {
       File file(nullptr, name, "ppm");
 
       if (!file.openForWrite()) return false;
 
-      file.printf("P3\n");
+      file.printf("P6\n");
       file.printf("%u %u\n", width, height);
       file.printf("255\n");
 
-      for(unsigned y = 0; y < height; y++)
+      uint8_t* line = new uint8_t[width * 3];
+      bool     ok   = true;
+
+      for(unsigned y = 0; ok && (y < height); y++)
       {
+         uint8_t* rgb = line;
+
          for(unsigned x = 0; x < width; x++)
          {
             STB::ColourDecode pixel = getPixel(x, y);
 
-            file.printf("%u %u %u ", pixel.red(), pixel.grn(), pixel.blu());
+            *rgb++ = pixel.red();
+            *rgb++ = pixel.grn();
+            *rgb++ = pixel.blu();
          }
-         file.printf("\n");
+
+         ok = (width == 0) || file.write(line, width * 3);
       }
 
-      return true;
+      delete[] line;
+
+      return ok;
    }
 
    uint8_t* buffer{nullptr};
@@ -125,6 +125,8 @@ void Frame::resize(unsigned width_, unsigned height_)
 
 void Frame::refresh() { pimpl->refresh(); }
 
+void Frame::damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2) {}
+
 // Some stubs for unimplemented functionality
 
 void* Frame::getHandle() const { return nullptr; }
@@ -10,6 +10,7 @@
 #include <cstdint>
 
 #include "MIDI/Interface.h"
+#include "MIDI/Scheduler.h"
 
 
 //! Platform abstraction layer
@@ -33,7 +34,27 @@ public:
    uint8_t rx() override;
    void tx(uint8_t byte) override;
 
+   //! Queue channel messages on a scheduler instead of applying them in tick()
+   //
+   //! The audio call-back then applies them with MIDI::Scheduler::process()
+   //! and dispatch(). Call tick() often, messages are stamped when it runs
+   void setScheduler(::MIDI::Scheduler<>* scheduler_)
+   {
+      scheduler = scheduler_;
+   }
+
+protected:
+   void channelMessage(uint8_t status_, uint8_t data1_, uint8_t data2_) override
+   {
+      if (scheduler != nullptr)
+         scheduler->post(status_, data1_, data2_);
+      else
+         dispatch(status_, data1_, data2_);
+   }
+
 private:
+   ::MIDI::Scheduler<>* scheduler{nullptr};
+
    struct Pimpl;
    Pimpl* pimpl;
 };
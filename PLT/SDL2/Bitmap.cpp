@@ -27,6 +27,7 @@ public:
       if (surface != nullptr)
       {
          SDL_FreeSurface(surface);
+         surface = nullptr;
       }
 
       if ((width_ == 0) || (height_ == 0))
@@ -88,7 +88,8 @@ public:
          SDL_SetWindowSize(window, width_, height_);
       }
 
-      renderer = SDL_CreateRenderer(window, -1, 0);
+      renderer = SDL_CreateRenderer(window, -1,
+                                    (flags & Frame::VSYNC) ? SDL_RENDERER_PRESENTVSYNC : 0);
 
       SDL_RaiseWindow(window);
 
@@ -177,11 +178,77 @@ public:
    {
       if (texture == nullptr) return;
 
-      SDL_UpdateTexture(texture, nullptr, surface->pixels, surface->pitch);
+      if ((num_dirty == 0) || full_refresh)
+      {
+         SDL_UpdateTexture(texture, nullptr, surface->pixels, surface->pitch);
+
+         num_dirty    = 0;
+         full_refresh = false;
+      }
+      else
+      {
+         const uint8_t* pixels = (const uint8_t*)surface->pixels;
+
+         for(unsigned i = 0; i < num_dirty; ++i)
+         {
+            const SDL_Rect& rect = dirty[i];
+
+            SDL_UpdateTexture(texture, &rect,
+                              pixels + rect.y * surface->pitch + rect.x * 4,
+                              surface->pitch);
+         }
+
+         num_dirty = 0;
+      }
+
       SDL_RenderCopy(renderer, texture, nullptr, nullptr);
       SDL_RenderPresent(renderer);
    }
 
+   void damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+   {
+      if (surface == nullptr) return;
+
+      if (x2 > unsigned(surface->w)) x2 = surface->w;
+      if (y2 > unsigned(surface->h)) y2 = surface->h;
+      if ((x1 >= x2) || (y1 >= y2)) return;
+
+      SDL_Rect rect{int(x1), int(y1), int(x2 - x1), int(y2 - y1)};
+
+      // Coalesce with any overlapping or touching region
+      for(unsigned i = 0; i < num_dirty; )
+      {
+         SDL_Rect& other = dirty[i];
+
+         if ((rect.x <= other.x + other.w) && (other.x <= rect.x + rect.w) &&
+             (rect.y <= other.y + other.h) && (other.y <= rect.y + rect.h))
+         {
+            SDL_UnionRect(&rect, &other, &rect);
+
+            // Remove the absorbed region and check again against the rest
+            other = dirty[--num_dirty];
+            i     = 0;
+         }
+         else
+         {
+            ++i;
+         }
+      }
+
+      if (num_dirty == MAX_DIRTY)
+      {
+         // Too many separate regions, fall back to one bounding region
+         for(unsigned i = 0; i < num_dirty; ++i)
+         {
+            SDL_UnionRect(&rect, &dirty[i], &rect);
+         }
+
+         num_dirty = 0;
+      }
+
+      dirty[num_dirty++] = rect;
+   }
+
    void setVisible(bool visible)
    {
       if (visible)
@@ -195,12 +262,17 @@ public:
    }
 
 private:
+   static const unsigned MAX_DIRTY = 16;
+
    std::string   title;
    uint32_t      flags;
    SDL_Window*   window{nullptr};
    SDL_Renderer* renderer{nullptr};
    SDL_Surface*  surface{nullptr};
    SDL_Texture*  texture{nullptr};
+   SDL_Rect      dirty[MAX_DIRTY];
+   unsigned      num_dirty{0};      //!< Zero implies the whole frame on refresh()
+   bool          full_refresh{true}; //!< New texture contents are undefined
 
    void createSurface(unsigned width_, unsigned height_)
    {
@@ -224,12 +296,16 @@ private:
                                   SDL_TEXTUREACCESS_STREAMING,
                                   width_, height_);
 #endif
+
+      full_refresh = true;
    }
 
    void destroySurface()
    {
       SDL_DestroyTexture(texture);
       SDL_FreeSurface(surface);
+
+      num_dirty = 0;
    }
 };
 
@@ -286,6 +362,11 @@ void Frame::refresh()
    pimpl->refresh();
 }
 
+void Frame::damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+{
+   pimpl->damage(x1, y1, x2, y2);
+}
+
 void Frame::setGenerator(Generator* generator_)
 {
    generator = generator_;
@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: MIT
 //-------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 
 #include "SDL_headers.h"
 
@@ -11,6 +13,16 @@
 
 namespace PLT {
 
+//! Convert a colour to the value stored for a pixel
+static inline uint32_t pixelValue(STB::Colour rgb)
+{
+#ifdef PDK_TARGET_Emscripten
+   return 0xFF000000 | rgb;
+#else
+   return rgb;
+#endif
+}
+
 unsigned Image::getPixelBits() { return 32; }
 
 uint32_t Image::getPixel(unsigned x, unsigned y) const
@@ -21,22 +33,31 @@ uint32_t Image::getPixel(unsigned x, unsigned y) const
 
 void Image::clear(STB::Colour rgb)
 {
-   defaultClear(rgb);
+   if (buffer == nullptr) return;
+
+   uint32_t value = pixelValue(rgb);
+
+   for(unsigned y = 0; y < height; y++)
+   {
+      uint32_t* line = reinterpret_cast<uint32_t*>(buffer + y * pitch);
+
+      std::fill_n(line, width, value);
+   }
 }
 
 void Image::point(STB::Colour rgb, unsigned x, unsigned y)
 {
    uint32_t* pixels = reinterpret_cast<uint32_t*>(buffer);
-#ifdef PDK_TARGET_Emscripten
-   pixels[x + y * pitch / 4] = 0xFF000000 | rgb;
-#else
-   pixels[x + y * pitch / 4] = rgb;
-#endif
+   pixels[x + y * pitch / 4] = pixelValue(rgb);
 }
 
 void Image::span(uint32_t rgb, unsigned x1, unsigned y, unsigned x2)
 {
-   defaultSpan(rgb, x1, y, x2);
+   if (x2 <= x1) return;
+
+   uint32_t* line = reinterpret_cast<uint32_t*>(buffer + y * pitch);
+
+   std::fill_n(line + x1, x2 - x1, pixelValue(rgb));
 }
 
 void Image::blit(const Image& source,
@@ -46,6 +67,50 @@ void Image::blit(const Image& source,
 {
    SDL_Surface* src = static_cast<SDL_Surface*>(source.getHandle());
 
+   // SDL_BlitSurface() does not support overlapping source and destination
+   if ((src == nullptr) || (getHandle() == nullptr) || (src == getHandle()))
+   {
+      // Copy pixel rows directly
+      unsigned src_pitch;
+      const uint8_t* src_buffer = source.getStorage(src_pitch);
+
+      if ((src_buffer == nullptr) || (buffer == nullptr))
+      {
+         defaultBlit(source, x, y, w, h, src_x, src_y);
+         return;
+      }
+
+      if ((x >= width) || (y >= height) ||
+          (src_x >= source.getWidth()) || (src_y >= source.getHeight()))
+      {
+         return;
+      }
+
+      w = std::min({w, width - x, source.getWidth() - src_x});
+      h = std::min({h, height - y, source.getHeight() - src_y});
+
+      const uint8_t* from = src_buffer + src_y * src_pitch + src_x * 4;
+      uint8_t*       to   = buffer + y * pitch + x * 4;
+
+      if ((from < to) && (src_buffer == buffer))
+      {
+         // Overlapping copy down an image, work from the bottom up
+         for(unsigned v = h; v-- > 0; )
+         {
+            memmove(to + v * pitch, from + v * src_pitch, w * 4);
+         }
+      }
+      else
+      {
+         for(unsigned v = 0; v < h; v++)
+         {
+            memmove(to + v * pitch, from + v * src_pitch, w * 4);
+         }
+      }
+
+      return;
+   }
+
    SDL_Rect srcrect;
    srcrect.x = src_x;
    srcrect.y = src_y;
@@ -49,6 +49,10 @@ void Frame::refresh()
 {
 }
 
+void Frame::damage(unsigned x1, unsigned y1, unsigned x2, unsigned y2)
+{
+}
+
 void Frame::setGenerator(Generator* generator_)
 {
 }
@@ -11,9 +11,15 @@ namespace PLT {
 
 namespace MIDI {
 
-Interface::Interface(::MIDI::Instrument& instrument_)
-   : ::MIDI::Interface(instrument_)
+Interface::Interface()
 {
+   pimpl = nullptr;
+}
+
+Interface::Interface(::MIDI::Instrument& instrument_, bool debug_)
+   : ::MIDI::Interface(instrument_, debug_)
+{
+   pimpl = nullptr;
 }
 
 Interface::~Interface() {}
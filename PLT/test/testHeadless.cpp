@@ -0,0 +1,788 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <vector>
+
+#include "PLT/Bitmap.h"
+#include "PLT/Event.h"
+#include "PLT/Frame.h"
+#include "PLT/Headless/Headless.h"
+
+#include "GUI/Bitmap.h"
+#include "GUI/Font/Teletext.h"
+#include "GUI/Frame.h"
+#include "GUI/GlyphCache.h"
+
+#include "STB/Test.h"
+
+TEST(PLT_Headless, frame_pixels)
+{
+   PLT::Frame frame("test", 64, 48);
+
+   EXPECT_EQ(32, PLT::Frame::getPixelBits());
+   EXPECT_EQ(64, frame.getWidth());
+   EXPECT_EQ(48, frame.getHeight());
+
+   frame.clear(STB::BLUE);
+   EXPECT_EQ(STB::BLUE, frame.getPixel(0, 0));
+   EXPECT_EQ(STB::BLUE, frame.getPixel(63, 47));
+
+   frame.point(STB::RED, 10, 20);
+   EXPECT_EQ(STB::RED, frame.getPixel(10, 20));
+
+   frame.span(STB::GREEN, 5, 30, 9);
+   EXPECT_EQ(STB::BLUE,  frame.getPixel(4, 30));
+   EXPECT_EQ(STB::GREEN, frame.getPixel(5, 30));
+   EXPECT_EQ(STB::GREEN, frame.getPixel(8, 30));
+   EXPECT_EQ(STB::BLUE,  frame.getPixel(9, 30));
+
+   frame.resize(32, 16);
+   EXPECT_EQ(32, frame.getWidth());
+   EXPECT_EQ(16, frame.getHeight());
+   frame.point(STB::RED, 31, 15);
+   EXPECT_EQ(STB::RED, frame.getPixel(31, 15));
+}
+
+TEST(PLT_Headless, blit)
+{
+   PLT::Frame  frame("test", 16, 16);
+   PLT::Bitmap bitmap(4, 4);
+
+   bitmap.clear(STB::WHITE);
+   bitmap.point(STB::RED, 1, 2);
+
+   frame.clear(STB::BLACK);
+   frame.blit(bitmap, 6, 7, 4, 4, 0, 0);
+
+   EXPECT_EQ(STB::BLACK, frame.getPixel(5, 7));
+   EXPECT_EQ(STB::WHITE, frame.getPixel(6, 7));
+   EXPECT_EQ(STB::RED,   frame.getPixel(7, 9));
+   EXPECT_EQ(STB::WHITE, frame.getPixel(9, 10));
+   EXPECT_EQ(STB::BLACK, frame.getPixel(10, 10));
+
+   // Overlapping copy down the same image
+   frame.blit(frame, 6, 8, 4, 4, 6, 7);
+   EXPECT_EQ(STB::RED,   frame.getPixel(7, 10));
+   EXPECT_EQ(STB::WHITE, frame.getPixel(7, 9));
+   EXPECT_EQ(STB::WHITE, frame.getPixel(9, 11));
+
+   // Clipped against the frame edge
+   frame.blit(bitmap, 14, 14, 4, 4, 0, 0);
+   EXPECT_EQ(STB::WHITE, frame.getPixel(15, 15));
+}
+
+static unsigned hook_calls = 0;
+static unsigned hook_x1, hook_y1, hook_x2, hook_y2;
+
+static void refreshHook(const PLT::Frame& frame,
+                        unsigned x1, unsigned y1, unsigned x2, unsigned y2,
+                        void* user_data)
+{
+   ++hook_calls;
+   hook_x1 = x1;
+   hook_y1 = y1;
+   hook_x2 = x2;
+   hook_y2 = y2;
+}
+
+TEST(PLT_Headless, refresh)
+{
+   PLT::Frame frame("test", 100, 50);
+
+   PLT::Headless::resetStats();
+   PLT::Headless::setRefreshHook(refreshHook);
+   hook_calls = 0;
+
+   // No damage recorded, whole frame
+   frame.refresh();
+   EXPECT_EQ(1, hook_calls);
+   EXPECT_EQ(100 * 50, PLT::Headless::getStats().refresh_pixels);
+
+   frame.damage(10, 10, 20, 15);
+   frame.damage(30, 5, 40, 12);
+   frame.refresh();
+   EXPECT_EQ(2, hook_calls);
+   EXPECT_EQ(10, hook_x1);
+   EXPECT_EQ(5,  hook_y1);
+   EXPECT_EQ(40, hook_x2);
+   EXPECT_EQ(15, hook_y2);
+
+   // Damage clipped to the frame
+   frame.damage(90, 40, 200, 200);
+   frame.refresh();
+   EXPECT_EQ(100, hook_x2);
+   EXPECT_EQ(50,  hook_y2);
+
+   EXPECT_EQ(3, PLT::Headless::getStats().refreshes);
+
+   PLT::Headless::setRefreshHook(nullptr);
+}
+
+TEST(PLT_Headless, gui_refresh)
+{
+   GUI::Frame frame("test", 80, 40);
+
+   PLT::Headless::setRefreshHook(refreshHook);
+   hook_calls = 0;
+
+   frame.fillRect(STB::YELLOW, 4, 4, 12, 8);
+   frame.refresh(4, 4, 12, 8);
+
+   EXPECT_EQ(1, hook_calls);
+   EXPECT_EQ(4,  hook_x1);
+   EXPECT_EQ(12, hook_x2);
+   EXPECT_EQ(STB::YELLOW, frame.getPixel(4, 4));
+
+   PLT::Headless::setRefreshHook(nullptr);
+}
+
+static unsigned num_keys = 0;
+static bool     got_quit = false;
+
+static void eventCallback(const PLT::Event::Message& event, void* user_data)
+{
+   if (event.type == PLT::Event::KEY_DOWN) ++num_keys;
+   if (event.type == PLT::Event::QUIT)     got_quit = true;
+}
+
+TEST(PLT_Headless, events)
+{
+   PLT::Event::Message event;
+
+   PLT::Headless::clearEvents();
+   PLT::Headless::pushKey('a');
+   EXPECT_EQ(2, PLT::Headless::getPendingEvents());
+
+   EXPECT_EQ(PLT::Event::KEY_DOWN, PLT::Event::poll(event));
+   EXPECT_EQ('a', event.code);
+   EXPECT_EQ(PLT::Event::KEY_UP, PLT::Event::wait(event));
+   EXPECT_EQ('a', event.code);
+
+   // End of the script
+   EXPECT_EQ(PLT::Event::QUIT, PLT::Event::poll(event));
+
+   PLT::Headless::pushText("hello");
+
+   PLT::Event::Message move;
+   move.type = PLT::Event::POINTER_MOVE;
+   move.x    = 12;
+   move.y    = 34;
+   PLT::Headless::pushEvent(move);
+
+   num_keys = 0;
+   got_quit = false;
+   EXPECT_EQ(0, PLT::Event::eventLoop(eventCallback));
+   EXPECT_EQ(5, num_keys);
+   EXPECT_TRUE(got_quit);
+   EXPECT_EQ(0, PLT::Headless::getPendingEvents());
+}
+
+TEST(PLT_Headless, timing)
+{
+   PLT::Frame frame("test", 320, 240);
+
+   const unsigned N = 100;
+
+   uint64_t start = PLT::Headless::getMicroseconds();
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      frame.clear(STB::Colour(i));
+      frame.refresh();
+   }
+
+   uint64_t elapsed = PLT::Headless::getMicroseconds() - start;
+
+   EXPECT_GE(PLT::Headless::getMicroseconds(), start);
+
+   printf("clear+refresh 320x240 : %.1f us\n", double(elapsed) / N);
+}
+
+TEST(PLT_Headless, save_ppm)
+{
+   PLT::Frame frame("test", 5, 3);
+
+   frame.clear(STB::RGB(0x12, 0x34, 0x56));
+   frame.point(STB::RED, 4, 2);
+
+   EXPECT_TRUE(frame.save("testHeadless"));
+
+   FILE* fp = fopen("testHeadless.ppm", "rb");
+   EXPECT_TRUE(fp != nullptr);
+   if (fp == nullptr) return;
+
+   char    header[11];
+   uint8_t pixels[5 * 3 * 3];
+
+   EXPECT_EQ(1, fread(header, sizeof(header), 1, fp));
+   EXPECT_EQ(0, memcmp(header, "P6\n5 3\n255\n", sizeof(header)));
+   EXPECT_EQ(1, fread(pixels, sizeof(pixels), 1, fp));
+   EXPECT_EQ(EOF, fgetc(fp));
+   fclose(fp);
+   remove("testHeadless.ppm");
+
+   EXPECT_EQ(0x12, pixels[0]);
+   EXPECT_EQ(0x34, pixels[1]);
+   EXPECT_EQ(0x56, pixels[2]);
+   EXPECT_EQ(0xFF, pixels[sizeof(pixels) - 3]);
+   EXPECT_EQ(0x00, pixels[sizeof(pixels) - 2]);
+}
+
+TEST(PLT_Headless, save_png)
+{
+   GUI::Frame frame("test", 97, 41);
+
+   for(int32_t y = 0; y < frame.getHeight(); ++y)
+   {
+      for(int32_t x = 0; x < frame.getWidth(); ++x)
+      {
+         frame.drawPoint(STB::RGB(x * 3, y * 5, (x ^ y) * 7), x, y);
+      }
+   }
+
+   frame.fillRect(STB::YELLOW, 10, 10, 60, 20);
+
+   EXPECT_TRUE(frame.savePNG("testHeadless"));
+
+   GUI::Bitmap bitmap("testHeadless.png");
+   remove("testHeadless.png");
+
+   EXPECT_EQ(frame.getWidth(),  bitmap.getWidth());
+   EXPECT_EQ(frame.getHeight(), bitmap.getHeight());
+
+   unsigned bad = 0;
+
+   for(int32_t y = 0; y < frame.getHeight(); ++y)
+   {
+      for(int32_t x = 0; x < frame.getWidth(); ++x)
+      {
+         if ((frame.getPixel(x, y) & 0xFFFFFF) != (bitmap.getPixel(x, y) & 0xFFFFFF)) ++bad;
+      }
+   }
+
+   EXPECT_EQ(0, bad);
+}
+
+//! Count pixels that differ between two canvases of the same size
+static unsigned countDiff(const GUI::Canvas& a_, const GUI::Canvas& b_)
+{
+   unsigned diff = 0;
+
+   for(int32_t y = 0; y < a_.getHeight(); ++y)
+   {
+      for(int32_t x = 0; x < a_.getWidth(); ++x)
+      {
+         if (a_.getPixel(x, y) != b_.getPixel(x, y)) ++diff;
+      }
+   }
+
+   return diff;
+}
+
+TEST(PLT_Headless, glyph_cache_text)
+{
+   // A 4-bit anti-aliased font exercises the blended colours
+   static const uint8_t ramp[] =
+   {
+      0x01, 0x23, 0x45, 0x67,   0x89, 0xAB, 0xCD, 0xEF,   // 'A'
+      0xF0, 0x0F, 0x5A, 0xA5,   0x00, 0xFF, 0x18, 0x81    // 'B'
+   };
+
+   static const GUI::Font font_ramp = {{8, 2}, 'A', 'B', 4, ramp};
+
+   GUI::Bitmap         direct(200, 40);
+   GUI::Bitmap         cached(200, 40);
+   GUI::GlyphCache<64> cache;
+
+   for(GUI::Canvas* canvas : {(GUI::Canvas*)&direct, (GUI::Canvas*)&cached})
+      canvas->clear(STB::BLUE);
+
+   direct.drawText(STB::YELLOW, STB::BLUE, 3, 5, &GUI::font_teletext18, "Hello, glyphs!");
+   direct.drawText(STB::WHITE, STB::BLUE, 7, 30, &font_ramp, "ABBA");
+
+   // Twice, the second time every character is a cache hit
+   for(unsigned pass = 0; pass < 2; ++pass)
+   {
+      cached.drawText(cache, STB::YELLOW, STB::BLUE, 3, 5, &GUI::font_teletext18, "Hello, glyphs!");
+      cached.drawText(cache, STB::WHITE, STB::BLUE, 7, 30, &font_ramp, "ABBA");
+
+      EXPECT_EQ(0, countDiff(direct, cached));
+   }
+}
+
+//! CRC-32 as used by PNG chunks
+static uint32_t crc32(const uint8_t* data_, size_t size_)
+{
+   uint32_t crc = 0xFFFFFFFF;
+
+   for(size_t i = 0; i < size_; ++i)
+   {
+      crc ^= data_[i];
+
+      for(unsigned bit = 0; bit < 8; ++bit)
+         crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+   }
+
+   return ~crc;
+}
+
+static void putBE32(std::vector<uint8_t>& out_, uint32_t value_)
+{
+   for(int shift = 24; shift >= 0; shift -= 8)
+      out_.push_back(uint8_t(value_ >> shift));
+}
+
+static void writeChunk(FILE* fp_, const char* type_, const std::vector<uint8_t>& data_)
+{
+   std::vector<uint8_t> chunk;
+
+   putBE32(chunk, data_.size());
+   chunk.insert(chunk.end(), type_, type_ + 4);
+   chunk.insert(chunk.end(), data_.begin(), data_.end());
+   putBE32(chunk, crc32(&chunk[4], chunk.size() - 4));
+
+   fwrite(chunk.data(), chunk.size(), 1, fp_);
+}
+
+//! Write a .png file from samples in scan-line order
+//
+//! Every scan-line is filtered with filter_ and the result deflated as a
+//! single stored block, split over two IDAT chunks and followed by an
+//! ancillary chunk
+static bool writePNG(const char*                  filename_,
+                     unsigned                     width_,
+                     unsigned                     height_,
+                     uint8_t                      depth_,
+                     uint8_t                      colour_type_,
+                     unsigned                     samples_per_pixel_,
+                     const std::vector<unsigned>& samples_,
+                     const std::vector<uint8_t>&  palette_ = {},
+                     uint8_t                      filter_ = 0)
+{
+   unsigned row_bytes = (width_ * samples_per_pixel_ * depth_ + 7) / 8;
+   unsigned bpp       = (samples_per_pixel_ * depth_ + 7) / 8;
+
+   std::vector<uint8_t> prev(row_bytes, 0);
+   std::vector<uint8_t> raw;
+
+   for(unsigned y = 0; y < height_; ++y)
+   {
+      std::vector<uint8_t> line(row_bytes, 0);
+
+      for(unsigned i = 0; i < width_ * samples_per_pixel_; ++i)
+      {
+         unsigned sample = samples_[y * width_ * samples_per_pixel_ + i];
+
+         if (depth_ == 16)
+         {
+            line[i * 2]     = uint8_t(sample >> 8);
+            line[i * 2 + 1] = uint8_t(sample);
+         }
+         else if (depth_ == 8)
+         {
+            line[i] = uint8_t(sample);
+         }
+         else
+         {
+            unsigned bit = i * depth_;
+
+            line[bit / 8] |= sample << (8 - depth_ - (bit % 8));
+         }
+      }
+
+      raw.push_back(filter_);
+
+      for(unsigned i = 0; i < row_bytes; ++i)
+      {
+         int a = i >= bpp ? line[i - bpp] : 0;
+         int b = prev[i];
+         int c = i >= bpp ? prev[i - bpp] : 0;
+
+         int predict = 0;
+
+         switch(filter_)
+         {
+         case 1: predict = a;           break;
+         case 2: predict = b;           break;
+         case 3: predict = (a + b) / 2; break;
+
+         case 4:
+         {
+            int p  = a + b - c;
+            int pa = abs(p - a);
+            int pb = abs(p - b);
+            int pc = abs(p - c);
+
+            predict = (pa <= pb) && (pa <= pc) ? a : pb <= pc ? b : c;
+         }
+         break;
+         }
+
+         raw.push_back(uint8_t(line[i] - predict));
+      }
+
+      prev = line;
+   }
+
+   uint16_t len = raw.size();
+
+   std::vector<uint8_t> zlib{0x78, 0x01, 0x01,
+                             uint8_t(len), uint8_t(len >> 8),
+                             uint8_t(~len), uint8_t(~len >> 8)};
+
+   zlib.insert(zlib.end(), raw.begin(), raw.end());
+
+   uint32_t a = 1, b = 0;
+
+   for(uint8_t byte : raw)
+   {
+      a = (a + byte) % 65521;
+      b = (b + a) % 65521;
+   }
+
+   putBE32(zlib, (b << 16) | a);
+
+   FILE* fp = fopen(filename_, "w");
+   if (fp == nullptr) return false;
+
+   fwrite("\x89PNG\r\n\x1A\n", 8, 1, fp);
+
+   std::vector<uint8_t> ihdr;
+   putBE32(ihdr, width_);
+   putBE32(ihdr, height_);
+   ihdr.insert(ihdr.end(), {depth_, colour_type_, 0, 0, 0});
+   writeChunk(fp, "IHDR", ihdr);
+
+   if (!palette_.empty())
+      writeChunk(fp, "PLTE", palette_);
+
+   size_t half = zlib.size() / 2;
+   writeChunk(fp, "IDAT", std::vector<uint8_t>(zlib.begin(), zlib.begin() + half));
+   writeChunk(fp, "IDAT", std::vector<uint8_t>(zlib.begin() + half, zlib.end()));
+
+   static const char text[] = "Comment\0fixture";
+   writeChunk(fp, "tEXt", std::vector<uint8_t>(text, text + sizeof(text) - 1));
+   writeChunk(fp, "IEND", {});
+
+   return fclose(fp) == 0;
+}
+
+//! Read a whole file into memory
+static std::vector<uint8_t> readFile(const char* filename_)
+{
+   std::vector<uint8_t> data;
+
+   FILE* fp = fopen(filename_, "rb");
+   if (fp == nullptr) return data;
+
+   int ch;
+   while((ch = fgetc(fp)) != EOF)
+      data.push_back(uint8_t(ch));
+
+   fclose(fp);
+
+   return data;
+}
+
+//! Count pixels decoded from a .png file that differ from those expected
+//
+//! The image is decoded both from the file and from memory, the file is
+//! removed once decoded
+static unsigned checkPNG(const char*                     filename_,
+                         unsigned                        width_,
+                         unsigned                        height_,
+                         const std::vector<STB::Colour>& expect_)
+{
+   static const unsigned MAX = 32;
+
+   std::vector<uint8_t> png = readFile(filename_);
+
+   unsigned bad = 0;
+
+   for(bool from_file : {true, false})
+   {
+      STB::Colour buffer[MAX * MAX];
+      unsigned    width  = MAX;
+      unsigned    height = MAX;
+
+      bool ok = from_file
+                   ? GUI::Bitmap::decodePNG(filename_, buffer, MAX * sizeof(STB::Colour),
+                                            width, height)
+                   : GUI::Bitmap::decodePNG(png.data(), png.size(), buffer, MAX * sizeof(STB::Colour),
+                                            width, height);
+
+      if (!ok || (width != width_) || (height != height_))
+      {
+         bad += width_ * height_;
+         continue;
+      }
+
+      for(unsigned y = 0; y < height_; ++y)
+      {
+         for(unsigned x = 0; x < width_; ++x)
+         {
+            if (buffer[y * MAX + x] != expect_[y * width_ + x]) ++bad;
+         }
+      }
+   }
+
+   remove(filename_);
+
+   return bad;
+}
+
+static STB::Colour grey(uint8_t level_, uint8_t alpha_ = 0xFF)
+{
+   return STB::RGBA(level_, level_, level_, alpha_);
+}
+
+TEST(PLT_Headless, png_grey_packed)
+{
+   // Widths that leave part of the last byte of each scan-line unused
+   static const unsigned WIDTH  = 11;
+   static const unsigned HEIGHT = 3;
+
+   for(uint8_t depth : {1, 2, 4})
+   {
+      std::vector<unsigned>    samples;
+      std::vector<STB::Colour> expect;
+
+      unsigned max = (1 << depth) - 1;
+
+      for(unsigned i = 0; i < WIDTH * HEIGHT; ++i)
+      {
+         unsigned sample = (i * 5 + i / WIDTH) & max;
+
+         samples.push_back(sample);
+         expect.push_back(grey(sample * (0xFF / max)));
+      }
+
+      EXPECT_TRUE(writePNG("testHeadless_grey.png", WIDTH, HEIGHT, depth, 0, 1, samples));
+      EXPECT_EQ(0, checkPNG("testHeadless_grey.png", WIDTH, HEIGHT, expect));
+   }
+}
+
+TEST(PLT_Headless, png_grey_16)
+{
+   std::vector<unsigned>    samples;
+   std::vector<STB::Colour> expect;
+
+   for(unsigned i = 0; i < 7 * 2; ++i)
+   {
+      unsigned sample = (i * 0x1357 + 0x00A5) & 0xFFFF;
+
+      samples.push_back(sample);
+      expect.push_back(grey(sample >> 8));
+   }
+
+   EXPECT_TRUE(writePNG("testHeadless_grey.png", 7, 2, 16, 0, 1, samples));
+   EXPECT_EQ(0, checkPNG("testHeadless_grey.png", 7, 2, expect));
+}
+
+TEST(PLT_Headless, png_indexed_short_palette)
+{
+   // Three entries for a 2-bit image, index 3 is not in the palette
+   static const std::vector<uint8_t> palette = {0x10, 0x20, 0x30,
+                                                0x40, 0x50, 0x60,
+                                                0x70, 0x80, 0x90};
+
+   std::vector<unsigned>    samples;
+   std::vector<STB::Colour> expect;
+
+   for(unsigned i = 0; i < 9 * 2; ++i)
+   {
+      unsigned index = (i * 3 + 1) & 3;
+
+      samples.push_back(index);
+      expect.push_back(index < 3 ? STB::RGBA(palette[index * 3],
+                                             palette[index * 3 + 1],
+                                             palette[index * 3 + 2], 0xFF)
+                                 : STB::RGBA(0x00, 0x00, 0x00, 0xFF));
+   }
+
+   EXPECT_TRUE(writePNG("testHeadless_indexed.png", 9, 2, 2, 3, 1, samples, palette));
+   EXPECT_EQ(0, checkPNG("testHeadless_indexed.png", 9, 2, expect));
+}
+
+TEST(PLT_Headless, png_grey_alpha)
+{
+   // One vector of four pixels and a scalar tail
+   std::vector<unsigned>    samples;
+   std::vector<STB::Colour> expect;
+
+   for(unsigned i = 0; i < 6 * 2; ++i)
+   {
+      uint8_t level = i * 21 + 3;
+      uint8_t alpha = 0xFF - i * 17;
+
+      samples.insert(samples.end(), {level, alpha});
+      expect.push_back(grey(level, alpha));
+   }
+
+   EXPECT_TRUE(writePNG("testHeadless_ga.png", 6, 2, 8, 4, 2, samples));
+   EXPECT_EQ(0, checkPNG("testHeadless_ga.png", 6, 2, expect));
+}
+
+TEST(PLT_Headless, png_rgba)
+{
+   std::vector<unsigned>    samples;
+   std::vector<STB::Colour> expect;
+
+   for(unsigned i = 0; i < 6 * 2; ++i)
+   {
+      uint8_t red = i * 19 + 1;
+      uint8_t grn = i * 7 + 0x40;
+      uint8_t blu = 0xF0 - i * 11;
+      uint8_t alp = i * 23 + 5;
+
+      samples.insert(samples.end(), {red, grn, blu, alp});
+      expect.push_back(STB::RGBA(red, grn, blu, alp));
+   }
+
+   EXPECT_TRUE(writePNG("testHeadless_rgba.png", 6, 2, 8, 6, 4, samples));
+   EXPECT_EQ(0, checkPNG("testHeadless_rgba.png", 6, 2, expect));
+}
+
+TEST(PLT_Headless, png_buffer_too_small)
+{
+   std::vector<unsigned> samples(13 * 5 * 3, 0x80);
+
+   EXPECT_TRUE(writePNG("testHeadless_rgb.png", 13, 5, 8, 2, 3, samples));
+
+   STB::Colour buffer[8 * 8];
+   unsigned    width  = 8;
+   unsigned    height = 8;
+
+   EXPECT_FALSE(GUI::Bitmap::decodePNG("testHeadless_rgb.png", buffer, 8 * sizeof(STB::Colour),
+                                       width, height));
+   EXPECT_EQ(13, width);
+   EXPECT_EQ(5,  height);
+
+   // Size query with no buffer
+   width  = 0;
+   height = 0;
+
+   EXPECT_FALSE(GUI::Bitmap::decodePNG("testHeadless_rgb.png", nullptr, 0, width, height));
+   EXPECT_EQ(13, width);
+   EXPECT_EQ(5,  height);
+
+   remove("testHeadless_rgb.png");
+}
+
+TEST(PLT_Headless, png_memory_truncated)
+{
+   std::vector<unsigned> samples(13 * 5 * 3, 0x80);
+
+   EXPECT_TRUE(writePNG("testHeadless_rgb.png", 13, 5, 8, 2, 3, samples));
+
+   std::vector<uint8_t> png = readFile("testHeadless_rgb.png");
+   remove("testHeadless_rgb.png");
+
+   STB::Colour buffer[16 * 16];
+   unsigned    width  = 16;
+   unsigned    height = 16;
+
+   EXPECT_TRUE(GUI::Bitmap::decodePNG(png.data(), png.size(), buffer, 16 * sizeof(STB::Colour),
+                                      width, height));
+   EXPECT_EQ(0xFF808080, buffer[4 * 16 + 12]);
+
+   // The compressed data ends before the IDAT CRC and the tEXt chunk, the
+   // Adler-32 is not needed to decode the rows
+   static const char text[] = "tEXt";
+
+   size_t end = std::search(png.begin(), png.end(), text, text + 4) - png.begin() - 4 - 4 - 4;
+
+   // Every length that cuts the compressed data fails inside the data given
+   unsigned bad = 0;
+
+   for(size_t size = 0; size < end; ++size)
+   {
+      std::vector<uint8_t> part(png.begin(), png.begin() + size);
+
+      width  = 16;
+      height = 16;
+
+      if (GUI::Bitmap::decodePNG(part.data(), part.size(), buffer, 16 * sizeof(STB::Colour),
+                                 width, height)) ++bad;
+   }
+
+   EXPECT_EQ(0, bad);
+}
+
+//! Expected colour of a decoded pixel from its samples
+static STB::Colour expectPixel(uint8_t colour_type_, uint8_t depth_, const unsigned* sample_)
+{
+   // Only the most significant 8 bits of 16 bit samples are kept
+   unsigned shift = depth_ == 16 ? 8 : 0;
+
+   auto s = [&](unsigned i) { return uint8_t(sample_[i] >> shift); };
+
+   switch(colour_type_)
+   {
+   case 0:  return grey(s(0));
+   case 2:  return STB::RGBA(s(0), s(1), s(2), 0xFF);
+   case 4:  return grey(s(0), s(1));
+   default: return STB::RGBA(s(0), s(1), s(2), s(3));
+   }
+}
+
+TEST(PLT_Headless, png_filters)
+{
+   struct Format
+   {
+      uint8_t  colour_type;
+      uint8_t  depth;
+      unsigned samples_per_pixel;
+   };
+
+   // Bytes per pixel 1, 2, 2, 3, 4, 4, 6 and 8
+   static const Format format[] =
+   {
+      {0, 8, 1}, {0, 16, 1}, {4, 8, 2}, {2, 8, 3}, {4, 16, 2}, {6, 8, 4}, {2, 16, 3}, {6, 16, 4}
+   };
+
+   // Widths that are not a multiple of any vector length
+   static const unsigned WIDTH[]  = {1, 5, 13, 31};
+   static const unsigned HEIGHT   = 4;
+
+   uint32_t seed = 1;
+
+   for(const Format& f : format)
+   {
+      for(unsigned width : WIDTH)
+      {
+         for(uint8_t filter = 0; filter <= 4; ++filter)
+         {
+            std::vector<unsigned>    samples;
+            std::vector<STB::Colour> expect;
+
+            unsigned max = (1 << f.depth) - 1;
+
+            for(unsigned i = 0; i < width * HEIGHT * f.samples_per_pixel; ++i)
+            {
+               seed = seed * 1103515245 + 12345;
+               samples.push_back((seed >> 8) & max);
+            }
+
+            for(unsigned i = 0; i < width * HEIGHT; ++i)
+            {
+               expect.push_back(expectPixel(f.colour_type, f.depth,
+                                            &samples[i * f.samples_per_pixel]));
+            }
+
+            EXPECT_TRUE(writePNG("testHeadless_filter.png", width, HEIGHT, f.depth, f.colour_type,
+                                 f.samples_per_pixel, samples, {}, filter));
+            EXPECT_EQ(0, checkPNG("testHeadless_filter.png", width, HEIGHT, expect));
+         }
+      }
+   }
+}
+
+TEST_MAIN
@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Control rate scheduling. Modulation sources are evaluated, and the
+// parameters they drive recomputed, once every PERIOD samples. In between,
+// the audio rate code interpolates e.g. with LinSlew, Gain ramps or
+// filter::BiQuad::processRamp().
+//
+//   SIG::Control<32> control;
+//
+//   control.process(n, [&]()
+//                      {
+//                         filter.setFreq(cutoff + depth * lfo.advance(control.PERIOD));
+//                      },
+//                      [&](unsigned offset_, unsigned n_)
+//                      {
+//                         filter.processRamp(in + offset_, out + offset_, n_);
+//                      });
+
+#pragma once
+
+#include "Const.h"
+#include "Types.h"
+
+namespace SIG {
+
+template <unsigned PERIOD_>
+class Control
+{
+   static_assert(PERIOD_ != 0);
+
+public:
+   //! Samples per control period
+   static constexpr unsigned PERIOD = PERIOD_;
+
+   //! Control rate (Hz)
+   static constexpr Rate RATE = SAMPLE_RATE / PERIOD;
+
+   Control() = default;
+
+   //! Restart the control period so the next block begins with an update
+   void sync() { remaining = 0; }
+
+   //! Split a block of n_ samples into control periods
+   //
+   //! control_() is called at the start of each control period and
+   //! render_(offset, n) for each run of samples between updates. A control
+   //! period may span the boundary between two blocks
+   template <typename CONTROL, typename RENDER>
+   void process(unsigned n_, CONTROL control_, RENDER render_)
+   {
+      for(unsigned offset = 0; offset < n_; )
+      {
+         if (remaining == 0)
+         {
+            control_();
+            remaining = PERIOD;
+         }
+
+         unsigned n = n_ - offset < remaining ? n_ - offset : remaining;
+
+         render_(offset, n);
+
+         offset    += n;
+         remaining -= n;
+      }
+   }
+
+private:
+   unsigned remaining{0}; //!< Samples until the next control update
+};
+
+} // namespace SIG
@@ -0,0 +1,191 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Uniformly partitioned overlap-save convolution for long impulse responses
+// e.g. reverbs and speaker cabinets
+//
+//   static SIG::Convolve<8, 600> reverb; // 256 sample blocks, up to 3.2 s
+//
+//   reverb.setIR(ir, ir_length);
+//
+//   reverb.process(in, out, n);
+//
+// The impulse response is cut into partitions of BLOCK samples and each is
+// held as the spectrum of a 2*BLOCK real FFT. Every BLOCK input samples the
+// last 2*BLOCK input samples are transformed into a ring of past spectra.
+// The output spectrum is the sum of each partition multiplied by the input
+// spectrum from as many blocks ago, and the second half of its inverse
+// transform is the next BLOCK output samples.
+//
+// The cost per sample is two FFTs of 2*BLOCK points shared over BLOCK
+// samples plus one complex multiply-add per partition, against one
+// multiply-add per impulse response sample for a direct FIR.
+//
+// Latency is BLOCK samples. The object is large, nothing is allocated.
+
+#pragma once
+
+#include <cstring>
+
+#include "FFT.h"
+#include "Simd.h"
+#include "Types.h"
+
+namespace SIG {
+
+template <unsigned LOG2_BLOCK, unsigned MAX_PARTITIONS>
+class Convolve
+{
+   static_assert(LOG2_BLOCK >= 1);
+   static_assert(MAX_PARTITIONS >= 1);
+
+public:
+   Convolve() = default;
+
+   static constexpr unsigned BLOCK      = 1 << LOG2_BLOCK;
+   static constexpr unsigned LATENCY    = BLOCK;                  //!< Samples
+   static constexpr unsigned MAX_LENGTH = BLOCK * MAX_PARTITIONS; //!< Impulse response samples
+
+   //! Set the impulse response, truncated to MAX_LENGTH
+   //
+   //! Transforms the whole response, so call outside the audio call-back
+   void setIR(const Signal* ir_, unsigned length_)
+   {
+      if (length_ > MAX_LENGTH) length_ = MAX_LENGTH;
+
+      partitions = length_ == 0 ? 1 : (length_ + BLOCK - 1) / BLOCK;
+
+      for(unsigned p = 0; p < partitions; ++p)
+      {
+         Float    x[SIZE] = {};
+         unsigned offset  = p * BLOCK;
+
+         for(unsigned i = 0; i < BLOCK && (offset + i) < length_; ++i)
+         {
+            // Fold in the scaling of the inverse transform
+            x[i] = ir_[offset + i] * Float(1.0 / SIZE);
+         }
+
+         FFTx::forwardReal(x, h_re[p], h_im[p]);
+      }
+
+      reset();
+   }
+
+   //! Discard the input history
+   void reset()
+   {
+      memset(x_re, 0, sizeof(x_re));
+      memset(x_im, 0, sizeof(x_im));
+      memset(input, 0, sizeof(input));
+      memset(output, 0, sizeof(output));
+
+      head = 0;
+      fill = 0;
+   }
+
+   //! Filter one sample
+   Signal operator()(Signal x_)
+   {
+      Signal y;
+
+      process(&x_, &y, 1);
+
+      return y;
+   }
+
+   //! Filter a block of any length
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      while(n_ != 0)
+      {
+         unsigned n = BLOCK - fill;
+         if (n > n_) n = n_;
+
+         memcpy(&input[BLOCK + fill], in_,            n * sizeof(Signal));
+         memcpy(out_,                 &output[fill], n * sizeof(Signal));
+
+         fill += n;
+         in_  += n;
+         out_ += n;
+         n_   -= n;
+
+         if (fill == BLOCK)
+         {
+            convolveBlock();
+            fill = 0;
+         }
+      }
+   }
+
+private:
+   using FFTx    = FFT<LOG2_BLOCK + 1>;
+   using VSignal = simd::VSignal;
+
+   static constexpr unsigned LANES  = simd::LANES;
+   static constexpr unsigned SIZE   = 2 * BLOCK;
+   static constexpr unsigned BINS   = BLOCK + 1;
+   static constexpr unsigned STRIDE = (BINS + LANES - 1) / LANES * LANES; //!< Padded bins
+
+   void convolveBlock()
+   {
+      // Spectrum of the last two blocks of input
+      FFTx::forwardReal(input, x_re[head], x_im[head]);
+
+      memcpy(input, &input[BLOCK], BLOCK * sizeof(Signal));
+
+      // Sum of the products of each partition with the matching past input
+      VSignal acc_re[STRIDE / LANES] = {};
+      VSignal acc_im[STRIDE / LANES] = {};
+
+      unsigned slot = head;
+
+      for(unsigned p = 0; p < partitions; ++p)
+      {
+         for(unsigned k = 0; k < STRIDE / LANES; ++k)
+         {
+            VSignal hr, hi, xr, xi;
+
+            memcpy(&hr, &h_re[p][k * LANES],    sizeof(hr));
+            memcpy(&hi, &h_im[p][k * LANES],    sizeof(hi));
+            memcpy(&xr, &x_re[slot][k * LANES], sizeof(xr));
+            memcpy(&xi, &x_im[slot][k * LANES], sizeof(xi));
+
+            acc_re[k] += xr * hr - xi * hi;
+            acc_im[k] += xr * hi + xi * hr;
+         }
+
+         slot = slot == 0 ? partitions - 1 : slot - 1;
+      }
+
+      if (++head == partitions) head = 0;
+
+      Float y_re[STRIDE];
+      Float y_im[STRIDE];
+      Float y[SIZE];
+
+      memcpy(y_re, acc_re, sizeof(y_re));
+      memcpy(y_im, acc_im, sizeof(y_im));
+
+      FFTx::inverseReal(y_re, y_im, y);
+
+      // First half is circular wrap-around, second half is valid
+      memcpy(output, &y[BLOCK], BLOCK * sizeof(Signal));
+   }
+
+   unsigned partitions{1};
+   unsigned head{0};       //!< Ring slot of the newest input spectrum
+   unsigned fill{0};       //!< Samples of the current block
+
+   alignas(sizeof(VSignal)) Float h_re[MAX_PARTITIONS][STRIDE] = {};
+   alignas(sizeof(VSignal)) Float h_im[MAX_PARTITIONS][STRIDE] = {};
+   alignas(sizeof(VSignal)) Float x_re[MAX_PARTITIONS][STRIDE] = {};
+   alignas(sizeof(VSignal)) Float x_im[MAX_PARTITIONS][STRIDE] = {};
+
+   Signal input[SIZE]   = {}; //!< Previous block then current block
+   Signal output[BLOCK] = {};
+};
+
+} // namespace SIG
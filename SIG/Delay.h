@@ -30,6 +30,21 @@ public:
    //! Provide the next input sample and return the current output sample
    Signal operator()(Signal x_) { return process(x_); }
 
+   //! Process a block of input samples into a block of output samples
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      Signal z = buffer;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         Signal y = z;
+         z        = in_[i];
+         out_[i]  = y;
+      }
+
+      buffer = z;
+   }
+
 private:
    //! Read the current output sample
    Signal read() const { return buffer; }
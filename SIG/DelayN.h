@@ -37,6 +37,24 @@ public:
    //! Provide the next input sample and return the current output sample
    Signal operator()(Signal x_) { return process(x_); }
 
+   //! Process a block of input samples into a block of output samples
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      unsigned i = index;
+
+      for(unsigned k = 0; k < n_; ++k)
+      {
+         Signal y  = buffer[i];
+         buffer[i] = in_[k];
+         out_[k]   = y;
+
+         if (++i >= LENGTH)
+            i = 0;
+      }
+
+      index = i;
+   }
+
 private:
    //! Read the current output sample
    Signal read() const { return buffer[index]; }
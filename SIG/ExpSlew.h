@@ -62,6 +62,53 @@ public:
       return in_ * operator()();
    }
 
+   //! Advance by a number of samples and return the value reached
+   Signal advance(unsigned n_)
+   {
+      // (1 - alpha)^n by repeated squaring
+      Float decay{1.0};
+
+      for(Float k = Float{1.0} - alpha; n_ != 0; n_ >>= 1, k *= k)
+      {
+         if (n_ & 1) decay *= k;
+      }
+
+      value = target + decay * (value - target);
+      return value;
+   }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      const Signal t = target;
+      const Float  a = alpha;
+      Signal       v = value;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         v += a * (t - v);
+         out_[i] = v;
+      }
+
+      value = v;
+   }
+
+   //! Multiply a block of samples by the current value
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Signal t = target;
+      const Float  a = alpha;
+      Signal       v = value;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         v += a * (t - v);
+         out_[i] = in_[i] * v;
+      }
+
+      value = v;
+   }
+
 private:
    Signal value{};
    Signal target{};
@@ -0,0 +1,314 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// In-place complex FFT on split real and imaginary arrays
+//
+//           N-1
+//   X[k] =  sum  x[n].exp(-j.2.pi.k.n / N)
+//           n=0
+//
+// Decimation in time with the radix-2 stages fused in pairs into radix-4
+// passes, so the data is swept log4(N) times rather than log2(N). An odd
+// LOG2_SIZE starts with a single trivial radix-2 stage. Each stage keeps its
+// twiddle factors contiguous so that the butterflies run across simd::LANES
+// at a time once a stage is wide enough.
+//
+// A real transform of SIZE samples is done as a complex transform of
+// SIZE/2 points, with even samples in the real part and odd samples in the
+// imaginary part, followed by a split into the SIZE/2 + 1 non-redundant bins.
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+#include "Simd.h"
+#include "Types.h"
+
+namespace SIG {
+
+template <unsigned LOG2_SIZE>
+class FFT
+{
+   static_assert(LOG2_SIZE >= 1);
+
+   template <unsigned> friend class FFT;
+
+public:
+   static constexpr unsigned SIZE = 1 << LOG2_SIZE;
+
+   //! Forward transform in place
+   static void forward(Float* re_, Float* im_)
+   {
+      transform(re_, im_, Float{-1.0});
+   }
+
+   //! Inverse transform in place (not scaled by 1/SIZE)
+   static void inverse(Float* re_, Float* im_)
+   {
+      transform(re_, im_, Float{+1.0});
+   }
+
+   //! Forward transform of SIZE real samples to bins 0..SIZE/2
+   //
+   //! re_ and im_ must each hold SIZE/2 + 1 values
+   static void forwardReal(const Float* x_, Float* re_, Float* im_)
+   {
+      static_assert(LOG2_SIZE >= 2);
+
+      const unsigned HALF = SIZE / 2;
+      const Twiddle& tw   = twiddle();
+
+      for(unsigned n = 0; n < HALF; ++n)
+      {
+         re_[n] = x_[2 * n];
+         im_[n] = x_[2 * n + 1];
+      }
+
+      FFT<LOG2_SIZE - 1>::forward(re_, im_);
+
+      // DC and Nyquist are real
+      Float z0r = re_[0];
+      Float z0i = im_[0];
+
+      re_[0]    = z0r + z0i;
+      im_[0]    = 0.0;
+      re_[HALF] = z0r - z0i;
+      im_[HALF] = 0.0;
+
+      for(unsigned k = 1; k <= HALF / 2; ++k)
+      {
+         unsigned j = HALF - k;
+
+         // Transforms of the even (e) and odd (o) samples
+         Float er  = Float(0.5) * (re_[k] + re_[j]);
+         Float ei  = Float(0.5) * (im_[k] - im_[j]);
+         Float odr = Float(0.5) * (im_[k] + im_[j]);
+         Float odi = Float(0.5) * (re_[j] - re_[k]);
+
+         // exp(-j.2.pi.k / SIZE)
+         Float wr =  tw.re[HALF - 1 + k];
+         Float wi = -tw.im[HALF - 1 + k];
+
+         Float tr = odr * wr - odi * wi;
+         Float ti = odr * wi + odi * wr;
+
+         re_[k] = er + tr;
+         im_[k] = ei + ti;
+         re_[j] = er - tr;
+         im_[j] = ti - ei;
+      }
+   }
+
+   //! Inverse of forwardReal() (not scaled by 1/SIZE)
+   //
+   //! re_ and im_ hold bins 0..SIZE/2 and are overwritten
+   static void inverseReal(Float* re_, Float* im_, Float* x_)
+   {
+      static_assert(LOG2_SIZE >= 2);
+
+      const unsigned HALF = SIZE / 2;
+      const Twiddle& tw   = twiddle();
+
+      Float dc  = re_[0];
+      Float nyq = re_[HALF];
+
+      re_[0] = dc + nyq;
+      im_[0] = dc - nyq;
+
+      for(unsigned k = 1; k <= HALF / 2; ++k)
+      {
+         unsigned j = HALF - k;
+
+         Float er = re_[k] + re_[j];
+         Float ei = im_[k] - im_[j];
+         Float dr = re_[k] - re_[j];
+         Float di = im_[k] + im_[j];
+
+         // exp(+j.2.pi.k / SIZE)
+         Float wr = tw.re[HALF - 1 + k];
+         Float wi = tw.im[HALF - 1 + k];
+
+         Float odr = dr * wr - di * wi;
+         Float odi = dr * wi + di * wr;
+
+         // Z = E + j.O
+         re_[k] = er - odi;
+         im_[k] = ei + odr;
+         re_[j] = er + odi;
+         im_[j] = odr - ei;
+      }
+
+      FFT<LOG2_SIZE - 1>::inverse(re_, im_);
+
+      for(unsigned n = 0; n < HALF; ++n)
+      {
+         x_[2 * n]     = re_[n];
+         x_[2 * n + 1] = im_[n];
+      }
+   }
+
+private:
+   using VFloat = simd::Vec<Float>;
+
+   static constexpr unsigned LANES = sizeof(VFloat) / sizeof(Float);
+
+   static void transform(Float* re_, Float* im_, Float sign_)
+   {
+      // Bit reversed re-ordering
+      for(unsigned i = 1, j = 0; i < SIZE; ++i)
+      {
+         unsigned bit = SIZE >> 1;
+
+         for(; (j & bit) != 0; bit >>= 1)
+            j ^= bit;
+
+         j ^= bit;
+
+         if (i < j)
+         {
+            Float t;
+            t = re_[i]; re_[i] = re_[j]; re_[j] = t;
+            t = im_[i]; im_[i] = im_[j]; im_[j] = t;
+         }
+      }
+
+      unsigned half = 1;
+
+      if ((LOG2_SIZE & 1) != 0)
+      {
+         // Radix-2 stage with all twiddles equal to one
+         for(unsigned k = 0; k < SIZE; k += 2)
+         {
+            Float tr = re_[k + 1];
+            Float ti = im_[k + 1];
+
+            re_[k + 1] = re_[k] - tr;
+            im_[k + 1] = im_[k] - ti;
+            re_[k]     = re_[k] + tr;
+            im_[k]     = im_[k] + ti;
+         }
+
+         half = 2;
+      }
+
+      for(; half < SIZE; half *= 4)
+      {
+         if (half >= LANES)
+            radix4<VFloat>(re_, im_, half, sign_);
+         else
+            radix4<Float>(re_, im_, half, sign_);
+      }
+   }
+
+   template <typename TYPE>
+   static TYPE load(const Float* ptr_)
+   {
+      TYPE v;
+      memcpy(&v, ptr_, sizeof(v));
+      return v;
+   }
+
+   template <typename TYPE>
+   static void store(Float* ptr_, TYPE v_)
+   {
+      memcpy(ptr_, &v_, sizeof(v_));
+   }
+
+   //! Two radix-2 stages, of half-width half_ and 2*half_, in one pass
+   template <typename TYPE>
+   static void radix4(Float* re_, Float* im_, unsigned half_, Float sign_)
+   {
+      const unsigned STEP = sizeof(TYPE) / sizeof(Float);
+      const Twiddle& tw   = twiddle();
+
+      // exp(sign.j.pi.m / half) and exp(sign.j.pi.m / (2.half))
+      const Float* w1r = tw.re + half_ - 1;
+      const Float* w1i = tw.im + half_ - 1;
+      const Float* w2r = tw.re + 2 * half_ - 1;
+      const Float* w2i = tw.im + 2 * half_ - 1;
+
+      for(unsigned k = 0; k < SIZE; k += 4 * half_)
+      {
+         for(unsigned m = 0; m < half_; m += STEP)
+         {
+            unsigned a0 = k + m;
+            unsigned a1 = a0 + half_;
+            unsigned a2 = a1 + half_;
+            unsigned a3 = a2 + half_;
+
+            TYPE ar = load<TYPE>(w1r + m);
+            TYPE ai = load<TYPE>(w1i + m) * sign_;
+            TYPE br = load<TYPE>(w2r + m);
+            TYPE bi = load<TYPE>(w2i + m) * sign_;
+
+            TYPE x0r = load<TYPE>(re_ + a0), x0i = load<TYPE>(im_ + a0);
+            TYPE x1r = load<TYPE>(re_ + a1), x1i = load<TYPE>(im_ + a1);
+            TYPE x2r = load<TYPE>(re_ + a2), x2i = load<TYPE>(im_ + a2);
+            TYPE x3r = load<TYPE>(re_ + a3), x3i = load<TYPE>(im_ + a3);
+
+            // First stage, (a0, a1) and (a2, a3)
+            TYPE tr = x1r * ar - x1i * ai;
+            TYPE ti = x1r * ai + x1i * ar;
+
+            x1r = x0r - tr; x1i = x0i - ti;
+            x0r = x0r + tr; x0i = x0i + ti;
+
+            tr = x3r * ar - x3i * ai;
+            ti = x3r * ai + x3i * ar;
+
+            x3r = x2r - tr; x3i = x2i - ti;
+            x2r = x2r + tr; x2i = x2i + ti;
+
+            // Second stage, (a0, a2) and (a1, a3) where the twiddle for the
+            // latter is a further quarter turn
+            tr = x2r * br - x2i * bi;
+            ti = x2r * bi + x2i * br;
+
+            store(re_ + a0, x0r + tr); store(im_ + a0, x0i + ti);
+            store(re_ + a2, x0r - tr); store(im_ + a2, x0i - ti);
+
+            TYPE ur = x3r * br - x3i * bi;
+            TYPE ui = x3r * bi + x3i * br;
+
+            tr = -ui * sign_;
+            ti =  ur * sign_;
+
+            store(re_ + a1, x1r + tr); store(im_ + a1, x1i + ti);
+            store(re_ + a3, x1r - tr); store(im_ + a3, x1i - ti);
+         }
+      }
+   }
+
+   //! exp(j.pi.m / half) for m < half, for each stage half = 1, 2, 4 ... SIZE/2
+   struct Twiddle
+   {
+      Twiddle()
+      {
+         for(unsigned half = 1; half < SIZE; half *= 2)
+         {
+            for(unsigned m = 0; m < half; ++m)
+            {
+               double theta = M_PI * m / half;
+
+               re[half - 1 + m] = Float(::cos(theta));
+               im[half - 1 + m] = Float(::sin(theta));
+            }
+         }
+      }
+
+      Float re[SIZE];
+      Float im[SIZE];
+   };
+
+   //! Twiddle factors shared by all users of this size
+   static const Twiddle& twiddle()
+   {
+      static const Twiddle table{};
+      return table;
+   }
+};
+
+} // namespace SIG
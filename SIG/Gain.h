@@ -23,6 +23,15 @@ public:
    //! Apply gain to a signal
    Signal operator()(Signal in_) const { return in_ * value; }
 
+   //! Apply gain to a block of samples
+   void process(const Signal* in_, Signal* out_, unsigned n_) const
+   {
+      const Signal v = value;
+
+      for(unsigned i = 0; i < n_; ++i)
+         out_[i] = in_[i] * v;
+   }
+
 private:
    Signal value{1.0};
 };
@@ -57,6 +57,43 @@ public:
       return in_ * operator()();
    }
 
+   //! Advance by a number of samples and return the value reached
+   Signal advance(unsigned n_)
+   {
+      value += delta * Float(n_);
+      return value;
+   }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      const Signal d = delta;
+      Signal       v = value;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         v += d;
+         out_[i] = v;
+      }
+
+      value = v;
+   }
+
+   //! Multiply a block of samples by the current value
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Signal d = delta;
+      Signal       v = value;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         v += d;
+         out_[i] = in_[i] * v;
+      }
+
+      value = v;
+   }
+
 private:
    Signal value{0.0};
    Signal delta{0.0};
@@ -0,0 +1,97 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Lock-free hand-off of a parameter set from one writer (a UI, MIDI handler
+// or the other core) to one reader (the audio code). The reader always sees
+// the most recently posted value, intermediate values may be skipped.
+//
+// A sequence count makes this a seqlock. Only atomic loads and stores are
+// used, no read-modify-write, so it also works between the cores of a
+// Cortex-M0+ and from interrupt handlers. A fetch that overlaps a post fails
+// and is simply retried on the next fetch.
+//
+//   SIG::Mailbox<Params> mailbox;
+//
+//   mailbox.post(params);              // writer
+//
+//   if (mailbox.pending())             // reader, once per block
+//      mailbox.fetch(params);
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace SIG {
+
+template <typename TYPE>
+class Mailbox
+{
+   static_assert(std::is_trivially_copyable_v<TYPE>);
+
+public:
+   Mailbox() = default;
+
+   //! Post a new value (writer side)
+   void post(const TYPE& value_)
+   {
+      uint32_t word[WORDS] = {};
+      memcpy(word, &value_, sizeof(TYPE));
+
+      uint32_t s = seq.load(std::memory_order_relaxed);
+
+      // An odd count marks a post in progress
+      seq.store(s + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      for(unsigned i = 0; i < WORDS; ++i)
+         data[i].store(word[i], std::memory_order_relaxed);
+
+      seq.store(s + 2, std::memory_order_release);
+   }
+
+   //! Check for a value posted since the last successful fetch (reader side)
+   bool pending() const
+   {
+      return seq.load(std::memory_order_relaxed) != seen;
+   }
+
+   //! Fetch the latest value (reader side)
+   //
+   //! \return false if there is no new value or a post was in progress
+   bool fetch(TYPE& value_)
+   {
+      uint32_t s = seq.load(std::memory_order_acquire);
+
+      if ((s == seen) || ((s & 1) != 0))
+         return false;
+
+      uint32_t word[WORDS];
+
+      for(unsigned i = 0; i < WORDS; ++i)
+         word[i] = data[i].load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (seq.load(std::memory_order_relaxed) != s)
+         return false;
+
+      memcpy(&value_, word, sizeof(TYPE));
+      seen = s;
+
+      return true;
+   }
+
+private:
+   static constexpr unsigned WORDS = (sizeof(TYPE) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+   std::atomic<uint32_t> seq{0};
+   std::atomic<uint32_t> data[WORDS] = {};
+   uint32_t              seen{0};    //!< Reader side
+};
+
+} // namespace SIG
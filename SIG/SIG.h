@@ -8,7 +8,10 @@
 #include "Types.h"
 #include "Const.h"
 #include "Conv.h"
+#include "Control.h"
+#include "Convolve.h"
 #include "Delay.h"
+#include "FFT.h"
 #include "DelayN.h"
 #include "DelayV.h"
 #include "env/env.h"
@@ -17,5 +20,7 @@
 #include "ExpSlew.h"
 #include "LogPot.h"
 #include "LinSlew.h"
+#include "Mailbox.h"
+#include "Resample.h"
 #include "osc/osc.h"
 #include "clip/clip.h"
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Portable vector lanes using the GCC/clang vector extension. The lane count
+// follows the host vector unit (AVX, SSE2, NEON) and degrades to a single
+// lane on targets without one (e.g. Cortex-M) where the compiler lowers the
+// operations to plain scalar code.
+
+#pragma once
+
+#include "Types.h"
+
+namespace SIG::simd {
+
+#if defined(__AVX__)
+inline constexpr unsigned VECTOR_BYTES = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+inline constexpr unsigned VECTOR_BYTES = 16;
+#else
+inline constexpr unsigned VECTOR_BYTES = sizeof(Signal);
+#endif
+
+//! Number of Signal lanes in a host vector register
+inline constexpr unsigned LANES = VECTOR_BYTES / sizeof(Signal);
+
+template <typename TYPE, unsigned N>
+struct VecType
+{
+   typedef TYPE Type __attribute__((vector_size(sizeof(TYPE) * N)));
+};
+
+//! Vector of N lanes of TYPE
+template <typename TYPE, unsigned N = LANES>
+using Vec = typename VecType<TYPE, N>::Type;
+
+using VSignal = Vec<Signal>;
+using VUPhase = Vec<UPhase>;
+using VSPhase = Vec<SPhase>;
+
+//! Broadcast a scalar to all lanes
+template <typename VEC, typename TYPE>
+inline VEC splat(TYPE value_)
+{
+   VEC v;
+
+   for(unsigned i = 0; i < sizeof(VEC) / sizeof(v[0]); ++i)
+      v[i] = value_;
+
+   return v;
+}
+
+//! Horizontal sum of all lanes
+template <typename VEC>
+inline auto sum(VEC v_)
+{
+   auto total = v_[0];
+
+   for(unsigned i = 1; i < sizeof(VEC) / sizeof(v_[0]); ++i)
+      total += v_[i];
+
+   return total;
+}
+
+//! Convert 32-bit unsigned phase to floating-point -1.0..1.0 (pi)
+inline VSignal uphase2signal(VUPhase uphase_)
+{
+   return __builtin_convertvector(VSPhase(uphase_), VSignal) * Signal(1.0 / 0x80000000);
+}
+
+//! Convert 32-bit unsigned phase to floating-point 0.0..1.0 (2pi)
+inline VSignal uphase2float(VUPhase uphase_)
+{
+   return __builtin_convertvector(VSPhase(uphase_ >> 1), VSignal) * Signal(1.0 / 0x80000000);
+}
+
+} // namespace SIG::simd
@@ -7,6 +7,7 @@
 
 #include "Hard.h"
 #include "No.h"
+#include "Oversample.h"
 #include "Poly.h"
 #include "Poly5.h"
 #include "Tanh.h"
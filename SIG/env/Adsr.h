@@ -122,6 +122,85 @@ public:
       return operator()() * in_;
    }
 
+   //! Advance by a number of samples and return the envelope reached
+   Signal advance(unsigned n_)
+   {
+      while(n_ != 0)
+      {
+         // Samples until the next phase transition, 0 if there isn't one
+         int32_t steps;
+
+         if (rate > 0)
+            steps = level + rate >= target ? 1 : (target - level + rate - 1) / rate;
+         else if (rate < 0)
+            steps = level < target ? 1 : (level - target) / -rate + 1;
+         else
+            steps = level < target ? 1 : 0;
+
+         if ((steps == 0) || (unsigned(steps) > n_))
+         {
+            level += rate * int32_t(n_);
+            break;
+         }
+
+         level = target;
+         setPhase(EnvPhase(phase + 1));
+         n_ -= steps;
+      }
+
+      return dBGainLookup_15((level - MAX) >> 8);
+   }
+
+   //! Render a block of envelope samples
+   void process(Signal* out_, unsigned n_)
+   {
+      int32_t l = level;
+      int32_t r = rate;
+      int32_t t = target;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         l += r;
+
+         if ((r <= 0) ? (l < t) : (l >= t))
+         {
+            l = t;
+            setPhase(EnvPhase(phase + 1));
+            r = rate;
+            t = target;
+         }
+
+         out_[i] = dBGainLookup_15((l - MAX) >> 8);
+      }
+
+      level = l;
+   }
+
+   //! Apply envelope to a block of samples
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      int32_t l = level;
+      int32_t r = rate;
+      int32_t t = target;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         l += r;
+
+         if ((r <= 0) ? (l < t) : (l >= t))
+         {
+            l = t;
+            setPhase(EnvPhase(phase + 1));
+            r = rate;
+            t = target;
+         }
+
+         out_[i] = dBGainLookup_15((l - MAX) >> 8) * in_[i];
+      }
+
+      level = l;
+   }
+
 private:
    static constexpr int32_t MAX = 0x5FFFFF;
 
@@ -46,26 +46,75 @@ public:
 
       if (--samples == 0)
       {
-         if (phase == DELAY)
-         {
-            phase   = ATTACK;
-            samples = attack_samples;
-            rate    = attack_rate;
-         }
-         else
+         nextPhase();
+      }
+
+      return level;
+   }
+
+   //! Advance by a number of samples and return the level reached
+   Signal advance(unsigned n_)
+   {
+      while((phase != SUSTAIN) && (samples != 0) && (n_ >= samples))
+      {
+         level += rate * Signal(samples);
+         n_    -= samples;
+         nextPhase();
+      }
+
+      level   += rate * Signal(n_);
+      samples -= n_;
+
+      return level;
+   }
+
+   //! Render a block of envelope samples
+   void process(Signal* out_, unsigned n_)
+   {
+      Signal   l = level;
+      Signal   r = rate;
+      unsigned s = samples;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         l += r;
+
+         if (--s == 0)
          {
-            phase = SUSTAIN;
-            level = Signal{1.0};
-            rate  = 0;
+            level = l;
+            nextPhase();
+            l = level;
+            r = rate;
+            s = samples;
          }
+
+         out_[i] = l;
       }
 
-      return level;
+      level   = l;
+      rate    = r;
+      samples = s;
    }
 
 private:
    enum EnvPhase { DELAY, ATTACK, SUSTAIN };
 
+   void nextPhase()
+   {
+      if (phase == DELAY)
+      {
+         phase   = ATTACK;
+         samples = attack_samples;
+         rate    = attack_rate;
+      }
+      else
+      {
+         phase = SUSTAIN;
+         level = Signal{1.0};
+         rate  = 0;
+      }
+   }
+
    EnvPhase phase{SUSTAIN};
    Signal   level{0.0};
    Signal   rate{0.0};
@@ -15,7 +15,9 @@
 
 #include <cmath>
 
+#include "SIG/Const.h"
 #include "SIG/Types.h"
+#include "BiQuadCoef.h"
 #include "Type.h"
 
 namespace SIG::filter {
@@ -27,6 +29,8 @@ public:
    {
       setType(type_);
       zero();
+
+      ramp = coef[ping_pong];
    }
 
    void setType(Type type_)
@@ -95,81 +99,87 @@ public:
       return y[0];
    }
 
+   //! Filter a block of samples, coefficient changes are picked up per block
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Coef c = coef[ping_pong];
+
+      Signal x1 = x[1], x2 = x[2];
+      Signal y1 = y[1], y2 = y[2];
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         Signal x0 = in_[i];
+         Signal y0 = c.b0 * x0 + c.b1 * x1 + c.b2 * x2
+                               - c.a1 * y1 - c.a2 * y2;
+
+         x2 = x1;
+         x1 = x0;
+
+         y2 = y1;
+         y1 = y0;
+
+         out_[i] = y0;
+      }
+
+      x[1] = x1; x[2] = x2;
+      y[1] = y1; y[2] = y2;
+   }
+
+   //! Filter a block of samples, ramping the coefficients linearly from the
+   //! end of the previous ramped block to the current set
+   //
+   //! For parameters updated at control rate, once per block, so that sweeps
+   //! are smooth without recomputing the coefficients every sample
+   void processRamp(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      if (n_ == 0) return;
+
+      const Coef  to = coef[ping_pong];
+      const Float r  = Float(1.0) / n_;
+      const Coef  d{(to.a1 - ramp.a1) * r, (to.a2 - ramp.a2) * r,
+                    (to.b0 - ramp.b0) * r, (to.b1 - ramp.b1) * r, (to.b2 - ramp.b2) * r};
+      Coef        c = ramp;
+
+      Signal x1 = x[1], x2 = x[2];
+      Signal y1 = y[1], y2 = y[2];
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         c.a1 += d.a1; c.a2 += d.a2;
+         c.b0 += d.b0; c.b1 += d.b1; c.b2 += d.b2;
+
+         Signal x0 = in_[i];
+         Signal y0 = c.b0 * x0 + c.b1 * x1 + c.b2 * x2
+                               - c.a1 * y1 - c.a2 * y2;
+
+         x2 = x1;
+         x1 = x0;
+
+         y2 = y1;
+         y1 = y0;
+
+         out_[i] = y0;
+      }
+
+      x[1] = x1; x[2] = x2;
+      y[1] = y1; y[2] = y2;
+
+      ramp = to;
+   }
+
 private:
    void computeCoef()
    {
       unsigned next = ping_pong ^ 1;
       Coef&    c    = coef[next];
 
-      float recip_a0;
-
-      switch(type)
-      {
-      case OFF:
-         c.a1 = 0.f;
-         c.a2 = 0.f;
-         c.b0 = 0.f;
-         c.b1 = 0.f;
-         c.b2 = 0.f;
-         break;
-
-      case BYPASS:
-         c.a1 = 0.f;
-         c.a2 = 0.f;
-         c.b0 = 1.f;
-         c.b1 = 0.f;
-         c.b2 = 0.f;
-         break;
-
-      case LOPASS:
-         recip_a0 = 1.f / (1.f + alpha);
-         c.a1 = (-2.f * cos_w0) * recip_a0;
-         c.a2 = (1.f - alpha) * recip_a0;
-         c.b0 = ((1.f - cos_w0) / 2.f) * recip_a0;
-         c.b1 = (1.f - cos_w0) * recip_a0;
-         c.b2 = c.b0;
-         break;
-
-      case HIPASS:
-         recip_a0 = 1.f / (1.f + alpha);
-         c.a1 = (-2.f * cos_w0) * recip_a0;
-         c.a2 = (1.f - alpha) * recip_a0;
-         c.b0 = ((1.f + cos_w0) / 2.f) * recip_a0;
-         c.b1 = (-1.f - cos_w0) * recip_a0;
-         c.b2 = c.b0;
-         break;
-
-      case LOSHELF:
-         recip_a0 = 1.f / (A + 1.f + (A - 1.f) * cos_w0 + two_sqrt_A * alpha);
-         c.a1 = (-2.f * (A - 1.f + (A + 1.f) * cos_w0)) * recip_a0;
-         c.a2 = ((A + 1.f) + (A - 1.f) * cos_w0 - two_sqrt_A * alpha) * recip_a0;
-         c.b0 = (A * (A + 1.f - (A - 1.f) * cos_w0 + two_sqrt_A * alpha)) * recip_a0;
-         c.b1 = (2.f * A * (A - 1.f - (A + 1.f) * cos_w0)) * recip_a0;
-         c.b2 = (A * (A + 1.f - (A - 1.f) * cos_w0 - two_sqrt_A * alpha)) * recip_a0;
-         break;
-
-      case HISHELF:
-         recip_a0 = 1.f / (A + 1.f - (A - 1.f) * cos_w0 + two_sqrt_A * alpha);
-         c.a1 = (2.f * (A - 1.f - (A + 1.f) * cos_w0)) * recip_a0;
-         c.a2 = ((A + 1.f) - (A - 1.f) * cos_w0 - two_sqrt_A * alpha) * recip_a0;
-         c.b0 = (A * (A + 1.f + (A - 1.f) * cos_w0 + two_sqrt_A * alpha)) * recip_a0;
-         c.b1 = (-2.f * A * (A - 1.f + (A + 1.f) * cos_w0)) * recip_a0;
-         c.b2 = (A * (A + 1.f + (A - 1.f) * cos_w0 - two_sqrt_A * alpha)) * recip_a0;
-         break;
-      }
+      computeBiQuadCoef(c, type, cos_w0, alpha, A, two_sqrt_A);
 
       ping_pong = next;
    }
 
-   struct Coef
-   {
-      // Float a0{}; has been normalized away to 1
-      Float a1{};
-      Float a2{};
-      Float b0{};
-      Float b1{};
-      Float b2{};
-   };
+   using Coef = BiQuadCoef;
 
    const Freq W0_1HZ{2.f * M_PI / SAMPLE_RATE};  //!< Angular frequency for 1Hz
 
@@ -180,6 +190,7 @@ private:
    // Coefficients
    Coef             coef[2];
    volatile uint8_t ping_pong{0};
+   Coef             ramp;        //!< Reached by the last processRamp()
 
    // Configuration
    Type  type{OFF};
@@ -0,0 +1,201 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// A chain of bi-quad sections in transposed direct form II
+//
+//   y  = b0.x + s1
+//   s1 = b1.x - a1.y + s2
+//   s2 = b2.x - a2.y
+//
+// Each section runs LANES filters in parallel vector lanes. The lanes can
+// share one set of coefficients (several channels through the same EQ) or
+// each have their own (several independent filters). Samples are
+// interleaved, LANES values per sample period.
+//
+// Coefficients are edited in a private set by setStage() and published by
+// update(). The audio side reads one of two published sets and acknowledges
+// the set it holds, so update() only ever writes the set that is not in use.
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include "SIG/Const.h"
+#include "SIG/Simd.h"
+#include "SIG/Types.h"
+#include "BiQuadCoef.h"
+#include "Type.h"
+
+namespace SIG::filter {
+
+template <unsigned STAGES, unsigned LANES = 1>
+class BiQuadCascade
+{
+   static_assert(STAGES != 0);
+   static_assert((LANES != 0) && ((LANES & (LANES - 1)) == 0));
+
+public:
+   BiQuadCascade()
+   {
+      for(unsigned stage = 0; stage < STAGES; ++stage)
+      {
+         setStage(stage, BYPASS, 1000.0f);
+
+         coef[0][stage] = edit[stage];
+         coef[1][stage] = edit[stage];
+      }
+
+      zero();
+   }
+
+   //! Number of sections in the chain
+   unsigned stages() const { return STAGES; }
+
+   //! Configure a section for all lanes, takes effect at the next update()
+   void setStage(unsigned stage_, Type type_, Freq freq_, float q_ = 1.0f, float db_gain_ = 0.0f)
+   {
+      BiQuadCoef c;
+      computeCoef(c, type_, freq_, q_, db_gain_);
+
+      // Lane by lane, vectors wider than the host are not passed by value
+      for(unsigned lane = 0; lane < LANES; ++lane)
+         setStage(stage_, lane, c);
+   }
+
+   //! Configure a section for one lane, takes effect at the next update()
+   void setStage(unsigned stage_, unsigned lane_,
+                 Type type_, Freq freq_, float q_ = 1.0f, float db_gain_ = 0.0f)
+   {
+      BiQuadCoef c;
+      computeCoef(c, type_, freq_, q_, db_gain_);
+
+      setStage(stage_, lane_, c);
+   }
+
+   //! Set section coefficients directly for one lane, takes effect at the next update()
+   void setStage(unsigned stage_, unsigned lane_, const BiQuadCoef& c_)
+   {
+      StageCoef& s = edit[stage_];
+
+      s.a1[lane_] = c_.a1;
+      s.a2[lane_] = c_.a2;
+      s.b0[lane_] = c_.b0;
+      s.b1[lane_] = c_.b1;
+      s.b2[lane_] = c_.b2;
+   }
+
+   //! Publish all coefficient changes made since the last update
+   //
+   //! \return false if the audio side has not yet picked up the previous
+   //!         update, the changes are kept and can be published later
+   bool update()
+   {
+      uint8_t current = live.load(std::memory_order_relaxed);
+
+      // The reader may still hold the other set
+      if (in_use.load(std::memory_order_acquire) != current)
+         return false;
+
+      uint8_t next = current ^ 1;
+
+      for(unsigned stage = 0; stage < STAGES; ++stage)
+         coef[next][stage] = edit[stage];
+
+      live.store(next, std::memory_order_release);
+      return true;
+   }
+
+   //! Reset filter state to zero
+   void zero()
+   {
+      for(unsigned stage = 0; stage < STAGES; ++stage)
+      {
+         s1[stage] = Vec{};
+         s2[stage] = Vec{};
+      }
+   }
+
+   //! Filter one sample period, LANES interleaved values, may be in place
+   void operator()(const Signal* in_, Signal* out_)
+   {
+      process(in_, out_, 1);
+   }
+
+   //! Filter a block of n_ sample periods of LANES interleaved values
+   //
+   //! Coefficient changes are picked up per block. May be used in place
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      uint8_t index = live.load(std::memory_order_acquire);
+      in_use.store(index, std::memory_order_release);
+
+      const StageCoef* set = coef[index];
+
+      for(unsigned stage = 0; stage < STAGES; ++stage)
+      {
+         const StageCoef c = set[stage];
+
+         Vec z1 = s1[stage];
+         Vec z2 = s2[stage];
+
+         // After the first section the data is already in out_
+         const Signal* src = stage == 0 ? in_ : out_;
+
+         for(unsigned i = 0; i < n_; ++i)
+         {
+            Vec x;
+            memcpy(&x, src + i * LANES, sizeof(Vec));
+
+            Vec y = c.b0 * x + z1;
+            z1    = c.b1 * x - c.a1 * y + z2;
+            z2    = c.b2 * x - c.a2 * y;
+
+            memcpy(out_ + i * LANES, &y, sizeof(Vec));
+         }
+
+         s1[stage] = z1;
+         s2[stage] = z2;
+      }
+   }
+
+private:
+   using Vec = simd::Vec<Signal, LANES>;
+
+   struct StageCoef
+   {
+      Vec a1{};
+      Vec a2{};
+      Vec b0{};
+      Vec b1{};
+      Vec b2{};
+   };
+
+   static void computeCoef(BiQuadCoef& c_, Type type_, Freq freq_, float q_, float db_gain_)
+   {
+      float w0         = W0_1HZ * freq_;
+      float cos_w0     = cosf(w0);
+      float alpha      = sinf(w0) / (2.0f * q_);
+      float A          = powf(10.0f, db_gain_ / 40.0f);
+      float two_sqrt_A = 2.0f * sqrtf(A);
+
+      computeBiQuadCoef(c_, type_, cos_w0, alpha, A, two_sqrt_A);
+   }
+
+   static constexpr float W0_1HZ{2.0f * M_PI / SAMPLE_RATE};  //!< Angular frequency for 1Hz
+
+   // Filter state
+   Vec s1[STAGES];
+   Vec s2[STAGES];
+
+   // Coefficients
+   StageCoef            edit[STAGES];    //!< Control side
+   StageCoef            coef[2][STAGES]; //!< Published
+   std::atomic<uint8_t> live{0};         //!< Set to use for the next block
+   std::atomic<uint8_t> in_use{0};       //!< Set held by the audio side
+};
+
+} // namespace SIG::filter
@@ -0,0 +1,101 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// Bi-quad coefficients normalised so that a0 is 1
+//
+//                     -1      -2
+//            b0 + b1.z  + b2.z
+//   H(z) = ----------------------
+//                     -1      -2
+//             1 + a1.z  + a2.z
+
+#pragma once
+
+#include "SIG/Types.h"
+#include "Type.h"
+
+namespace SIG::filter {
+
+struct BiQuadCoef
+{
+   // Float a0{}; has been normalized away to 1
+   Float a1{};
+   Float a2{};
+   Float b0{};
+   Float b1{};
+   Float b2{};
+};
+
+//! Compute coefficients from the derived filter configuration
+//
+//! \param alpha_      sin(w0) / 2.Q
+//! \param A_          10^(gain_dB / 40)
+//! \param two_sqrt_A_ 2.sqrt(A)
+inline void computeBiQuadCoef(BiQuadCoef& c_,
+                              Type        type_,
+                              Float       cos_w0_,
+                              Float       alpha_,
+                              Float       A_,
+                              Float       two_sqrt_A_)
+{
+   float recip_a0;
+
+   switch(type_)
+   {
+   case OFF:
+      c_.a1 = 0.f;
+      c_.a2 = 0.f;
+      c_.b0 = 0.f;
+      c_.b1 = 0.f;
+      c_.b2 = 0.f;
+      break;
+
+   case BYPASS:
+      c_.a1 = 0.f;
+      c_.a2 = 0.f;
+      c_.b0 = 1.f;
+      c_.b1 = 0.f;
+      c_.b2 = 0.f;
+      break;
+
+   case LOPASS:
+      recip_a0 = 1.f / (1.f + alpha_);
+      c_.a1 = (-2.f * cos_w0_) * recip_a0;
+      c_.a2 = (1.f - alpha_) * recip_a0;
+      c_.b0 = ((1.f - cos_w0_) / 2.f) * recip_a0;
+      c_.b1 = (1.f - cos_w0_) * recip_a0;
+      c_.b2 = c_.b0;
+      break;
+
+   case HIPASS:
+      recip_a0 = 1.f / (1.f + alpha_);
+      c_.a1 = (-2.f * cos_w0_) * recip_a0;
+      c_.a2 = (1.f - alpha_) * recip_a0;
+      c_.b0 = ((1.f + cos_w0_) / 2.f) * recip_a0;
+      c_.b1 = (-1.f - cos_w0_) * recip_a0;
+      c_.b2 = c_.b0;
+      break;
+
+   case LOSHELF:
+      recip_a0 = 1.f / (A_ + 1.f + (A_ - 1.f) * cos_w0_ + two_sqrt_A_ * alpha_);
+      c_.a1 = (-2.f * (A_ - 1.f + (A_ + 1.f) * cos_w0_)) * recip_a0;
+      c_.a2 = ((A_ + 1.f) + (A_ - 1.f) * cos_w0_ - two_sqrt_A_ * alpha_) * recip_a0;
+      c_.b0 = (A_ * (A_ + 1.f - (A_ - 1.f) * cos_w0_ + two_sqrt_A_ * alpha_)) * recip_a0;
+      c_.b1 = (2.f * A_ * (A_ - 1.f - (A_ + 1.f) * cos_w0_)) * recip_a0;
+      c_.b2 = (A_ * (A_ + 1.f - (A_ - 1.f) * cos_w0_ - two_sqrt_A_ * alpha_)) * recip_a0;
+      break;
+
+   case HISHELF:
+      recip_a0 = 1.f / (A_ + 1.f - (A_ - 1.f) * cos_w0_ + two_sqrt_A_ * alpha_);
+      c_.a1 = (2.f * (A_ - 1.f - (A_ + 1.f) * cos_w0_)) * recip_a0;
+      c_.a2 = ((A_ + 1.f) - (A_ - 1.f) * cos_w0_ - two_sqrt_A_ * alpha_) * recip_a0;
+      c_.b0 = (A_ * (A_ + 1.f + (A_ - 1.f) * cos_w0_ + two_sqrt_A_ * alpha_)) * recip_a0;
+      c_.b1 = (-2.f * A_ * (A_ - 1.f + (A_ + 1.f) * cos_w0_)) * recip_a0;
+      c_.b2 = (A_ * (A_ + 1.f + (A_ - 1.f) * cos_w0_ - two_sqrt_A_ * alpha_)) * recip_a0;
+      break;
+   }
+}
+
+} // namespace SIG::filter
@@ -24,6 +24,21 @@ public:
       return y;
    }
 
+   //! Filter a block of samples
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Gain a = alpha;
+      Signal     z = delay();
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         z       = in_[i] + a(z);
+         out_[i] = z;
+      }
+
+      delay = z;
+   }
+
    Gain alpha{};
 
 private:
@@ -20,6 +20,22 @@ public:
       return x_ + alpha(delay(x_));
    }
 
+   //! Filter a block of samples
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Gain a = alpha;
+      Signal     z = delay();
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         Signal x = in_[i];
+         out_[i]  = x + a(z);
+         z        = x;
+      }
+
+      delay = z;
+   }
+
    Gain alpha{};
 
 private:
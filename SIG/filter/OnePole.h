@@ -7,6 +7,7 @@
 
 #include <cmath>
 
+#include "SIG/Const.h"
 #include "SIG/Types.h"
 #include "Type.h"
 
@@ -56,6 +57,29 @@ public:
       return y[0];
    }
 
+   //! Filter a block of samples, coefficient changes are picked up per block
+   void process(const Signal* in_, Signal* out_, unsigned n_)
+   {
+      const Coef c = coef[ping_pong];
+
+      Signal x1 = x[1];
+      Signal y1 = y[1];
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         Signal x0 = in_[i];
+         Signal y0 = c.b0 * x0 + c.b1 * x1 - c.a1 * y1;
+
+         x1 = x0;
+         y1 = y0;
+
+         out_[i] = y0;
+      }
+
+      x[1] = x1;
+      y[1] = y1;
+   }
+
 private:
    void computeCoef()
    {
@@ -8,5 +8,6 @@
 #include "OnePole.h"
 #include "BiQuad.h"
 #include "DualBiQuad.h"
+#include "BiQuadCascade.h"
 #include "FBComb.h"
 #include "FFComb.h"
@@ -7,12 +7,14 @@
 
 #include <cmath>
 
+#include "SIG/FFT.h"
+
 #include "WaveTable.h"
 
 namespace SIG::osc {
 
-template <unsigned N>
-class Additive : public WaveTable<>
+template <unsigned N, unsigned LOG2_SIZE = 10, unsigned LEVELS = 1>
+class Additive : public WaveTable<LOG2_SIZE, LEVELS>
 {
 public:
    Additive() = default;
@@ -21,6 +23,8 @@ public:
    Float b[N + 1] = {};
 
 private:
+   using Table = WaveTable<LOG2_SIZE, LEVELS>;
+
    Signal wavetableSample(Float t) override
    {
       Signal value = a[0] / 2.0;
@@ -38,6 +42,43 @@ private:
 
       return value;
    }
+
+   //! Synthesise a table from the harmonic series with an inverse FFT
+   void bandLimitedTable(Signal* data_, unsigned harmonics_) override
+   {
+      constexpr unsigned SIZE = Table::SIZE;
+
+      unsigned limit = harmonics_ < N ? harmonics_ : N;
+      if (limit > SIZE / 2) limit = SIZE / 2;
+
+      Float* re = data_;
+      Float  im[SIZE];
+
+      for(unsigned i = 0; i < SIZE; ++i)
+      {
+         re[i] = im[i] = Float{0.0};
+      }
+
+      re[0] = a[0] / 2.0;
+
+      for(unsigned n = 1; n <= limit; ++n)
+      {
+         if (n == SIZE / 2)
+         {
+            // Nyquist bin can only represent the cosine term
+            re[n] += b[n];
+         }
+         else
+         {
+            re[n]        = b[n] / 2.0;
+            im[n]        = -a[n] / 2.0;
+            re[SIZE - n] = b[n] / 2.0;
+            im[SIZE - n] = a[n] / 2.0;
+         }
+      }
+
+      FFT<LOG2_SIZE>::inverse(re, im);
+   }
 };
 
 } // namespace SIG::osc
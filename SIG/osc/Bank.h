@@ -0,0 +1,211 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// A bank of N oscillators sharing one waveform. Phase, increment and gain are
+// stored as a structure of arrays so that each vector register holds one
+// lane per voice. The render loop therefore scales with the vector width of
+// the host rather than the number of voices.
+
+#pragma once
+
+#include "SIG/Const.h"
+#include "SIG/Conv.h"
+#include "SIG/Simd.h"
+#include "SIG/Types.h"
+
+namespace SIG::osc {
+
+template <unsigned N>
+class Bank
+{
+   static_assert(N != 0);
+
+public:
+   enum Wave { SINE, TRIANGLE, RAMP, SQUARE };
+
+   Bank() = default;
+
+   //! \return number of voices
+   unsigned size() const { return N; }
+
+   //! Select waveform for all voices
+   void setWave(Wave wave_) { wave = wave_; }
+
+   //! Silence a voice
+   void mute(unsigned voice_)
+   {
+      sync(voice_);
+      setDelta(voice_, 0);
+   }
+
+   //! Reset phase of a voice to zero
+   void sync(unsigned voice_)
+   {
+      phase[voice_ / LANES][voice_ % LANES] = 0;
+   }
+
+   //! Set phase increment delta for a voice
+   void setDelta(unsigned voice_, UPhase delta_)
+   {
+      Signal t = uphase2float(delta_);
+
+      delta[voice_ / LANES][voice_ % LANES]    = delta_;
+      dt[voice_ / LANES][voice_ % LANES]       = t;
+      recip_dt[voice_ / LANES][voice_ % LANES] = t > 0 ? Signal(1.0) / t : Signal(0.0);
+   }
+
+   //! Set frequency for a voice
+   void setFreq(unsigned voice_, float freq_hz_, unsigned step_freq_ = SAMPLE_RATE)
+   {
+      float ratio = freq_hz_ / step_freq_;
+
+      setDelta(voice_, signal2uphase(ratio * 2.0));
+   }
+
+   //! Set frequency of a voice for MIDI note value with optional detune (fixed-point-7)
+   void setNote(unsigned voice_, uint8_t midi_note_, int32_t detune_ = 0)
+   {
+      int32_t note_7 = (midi_note_ << 7) + detune_;
+      if (note_7 < 0) note_7 = 0;
+
+      setDelta(voice_, noteLookup_7(note_7));
+   }
+
+   //! Set (linear) gain for a voice
+   void setGain(unsigned voice_, Signal gain_)
+   {
+      gain[voice_ / LANES][voice_ % LANES] = gain_;
+   }
+
+   //! Get the current phase of a voice
+   UPhase getPhase(unsigned voice_) const { return phase[voice_ / LANES][voice_ % LANES]; }
+
+   //! Render the sum of all voices for a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      switch(wave)
+      {
+      case SINE:     render<SINE>(out_, n_);     break;
+      case TRIANGLE: render<TRIANGLE>(out_, n_); break;
+      case RAMP:     render<RAMP>(out_, n_);     break;
+      case SQUARE:   render<SQUARE>(out_, n_);   break;
+      }
+   }
+
+private:
+   using VSignal = simd::VSignal;
+   using VUPhase = simd::VUPhase;
+
+   static constexpr unsigned LANES = simd::LANES;
+   static constexpr unsigned NV    = (N + LANES - 1) / LANES; //!< Vectors per bank
+   static constexpr unsigned CHUNK = 32;                       //!< Samples per pass
+
+   template <Wave WAVE>
+   void render(Signal* out_, unsigned n_)
+   {
+      for(unsigned base = 0; base < n_; base += CHUNK)
+      {
+         unsigned n = n_ - base < CHUNK ? n_ - base : CHUNK;
+
+         VSignal acc[CHUNK];
+
+         for(unsigned i = 0; i < n; ++i)
+            acc[i] = VSignal{};
+
+         // Hold one vector of voice state in registers for the whole pass
+         for(unsigned v = 0; v < NV; ++v)
+         {
+            const VUPhase d = delta[v];
+            const VSignal w = dt[v];
+            const VSignal r = recip_dt[v];
+            const VSignal g = gain[v];
+            VUPhase       p = phase[v];
+
+            for(unsigned i = 0; i < n; ++i)
+            {
+               acc[i] += g * sample<WAVE>(p, w, r);
+               p += d;
+            }
+
+            phase[v] = p;
+         }
+
+         for(unsigned i = 0; i < n; ++i)
+            out_[base + i] = simd::sum(acc[i]);
+      }
+   }
+
+   template <Wave WAVE>
+   static VSignal sample(VUPhase phase_, VSignal dt_, VSignal recip_dt_)
+   {
+      const VSignal one = simd::splat<VSignal>(1.0);
+
+      if constexpr (WAVE == SINE)
+      {
+         // Fold to -0.5..0.5 (x pi) and use an odd polynomial for sin(pi.x)
+         VSignal x = simd::uphase2signal(phase_);
+         VSignal s = x < Signal(0) ? -one : one;
+         VSignal y = (x * s) > Signal(0.5) ? s - x : x;
+         VSignal z = y * y;
+
+         return y * (Signal(+3.14159265358979) +
+                z * (Signal(-5.16771278004997) +
+                z * (Signal(+2.55016403987735) +
+                z * (Signal(-0.59926452932079) +
+                z * (Signal(+0.08214588661112))))));
+      }
+      else if constexpr (WAVE == TRIANGLE)
+      {
+         VSignal x = simd::uphase2signal(phase_);
+         VSignal s = x < Signal(0) ? -one : one;
+
+         return (x * s) > Signal(0.5) ? (s - x) * Signal(2.0)
+                                      : x * Signal(2.0);
+      }
+      else if constexpr (WAVE == RAMP)
+      {
+         VSignal x = simd::uphase2signal(phase_);
+         VSignal t = simd::uphase2float(phase_ - UPHASE_HALF);
+
+         return x - polyBLEP(t, dt_, recip_dt_);
+      }
+      else
+      {
+         // Sign taken from the phase MSB so the edge matches Square exactly
+         VSignal h = __builtin_convertvector(simd::VSPhase(phase_ >> 31), VSignal);
+         VSignal x = one - h - h;
+         VSignal t = simd::uphase2float(phase_);
+
+         x += polyBLEP(t, dt_, recip_dt_);
+         t  = simd::uphase2float(phase_ - UPHASE_HALF);
+         x -= polyBLEP(t, dt_, recip_dt_);
+
+         return x;
+      }
+   }
+
+   //! Branch free polyBLEP, see Base::polyBLEP()
+   static VSignal polyBLEP(VSignal t_, VSignal dt_, VSignal recip_dt_)
+   {
+      const VSignal one = simd::splat<VSignal>(1.0);
+
+      VSignal u  = t_ * recip_dt_;
+      VSignal lo = u + u - u * u - one;
+      VSignal w  = (t_ - one) * recip_dt_;
+      VSignal hi = w + w + w * w + one;
+
+      return t_ < dt_ ? lo
+                      : (t_ > (one - dt_) ? hi : VSignal{});
+   }
+
+   Wave    wave{SINE};
+   VUPhase phase[NV]    = {};
+   VUPhase delta[NV]    = {};
+   VSignal dt[NV]       = {};
+   VSignal recip_dt[NV] = {};
+   VSignal gain[NV]     = {};
+};
+
+} // namespace SIG::osc
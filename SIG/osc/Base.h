@@ -8,32 +8,69 @@
 #include "SIG/Const.h"
 #include "SIG/Conv.h"
 #include "SIG/Gain.h"
+#include "SIG/Mailbox.h"
 #include "SIG/Types.h"
 
 namespace SIG::osc {
 
+//! Common oscillator state
+//
+//! The setters below may be called from a different thread, interrupt
+//! handler or core to the one rendering samples. They post the new
+//! parameters through a Mailbox and the render methods pick them up, so the
+//! render state itself is plain data that can be held in registers
 class Base
 {
 public:
    Base() = default;
 
+   //! Copy, the mailbox is not copied but the copy is sent the latest
+   //! control side parameters
+   Base(const Base& other_)
+   {
+      *this = other_;
+   }
+
+   Base& operator=(const Base& other_)
+   {
+      gain            = other_.gain;
+      phase           = other_.phase;
+      delta           = other_.delta;
+      dt              = other_.dt;
+      ctrl            = other_.ctrl;
+      exp_freq_detune = other_.exp_freq_detune;
+      midi_note       = other_.midi_note;
+      exp_freq        = other_.exp_freq;
+      mod_exp_freq    = other_.mod_exp_freq;
+      phase_seq       = other_.phase_seq;
+      delta_seq       = other_.delta_seq;
+
+      mailbox.post(ctrl);
+
+      return *this;
+   }
+
    void mute()
    {
-      phase = 0;
-      delta = 0;
+      ctrl.delta = 0;
+      ctrl.delta_seq++;
+      ctrl.phase = 0;
+      ctrl.phase_seq++;
+      mailbox.post(ctrl);
    }
 
    //! Reset phase to zero
    void sync()
    {
-      phase = 0;
+      setPhase(0);
    }
 
    //! Set phase increment delta
    void setDelta(UPhase delta_)
    {
-      delta = delta_;
-      dt    = uphase2float(delta_);
+      ctrl.delta = delta_;
+      ctrl.delta_seq++;
+      mailbox.post(ctrl);
    }
 
    //! Set frequency
@@ -73,15 +110,52 @@ public:
       setDelta(noteLookup_7(ef));
    }
 
+   //! Set frequency modulation relative to the MIDI note and detune (semitones)
+   //
+   //! Intended for modulation evaluated at control rate, the note table is
+   //! only consulted when the modulated value changes. Unlike the setters
+   //! above this is called by the rendering thread
+   void setMod(Signal mod_)
+   {
+      receive();
+
+      uint32_t ef = exp_freq + signed(mod_ * EXP_FREQ_SCALE);
+
+      if (ef != mod_exp_freq)
+      {
+         mod_exp_freq = ef;
+         applyDelta(noteLookup_7(ef));
+      }
+   }
+
    //! Get the current phase
    UPhase getPhase() const { return phase; }
 
    //! Set the current phase
-   void setPhase(UPhase phase_) { phase = phase_; }
+   void setPhase(UPhase phase_)
+   {
+      ctrl.phase = phase_;
+      ctrl.phase_seq++;
+      mailbox.post(ctrl);
+   }
 
    Gain gain{};
 
 protected:
+   //! Apply any parameters posted since the last call (rendering side)
+   void receive()
+   {
+      if (mailbox.pending())
+         fetchParams();
+   }
+
+   //! Set phase increment delta (rendering side)
+   void applyDelta(UPhase delta_)
+   {
+      delta = delta_;
+      dt    = uphase2float(delta_);
+   }
+
    //! Calculate delta for a frequency modulation input
    uint32_t modDelta(Signal mod_)
    {
@@ -89,39 +163,90 @@ protected:
    }
 
    //! Polynomial to pre-filter hard edges in waveforms in the range [-dt, dt]
-   float polyBLEP(float t)
+   float polyBLEP(float t) const
+   {
+      return polyBLEP(t, dt);
+   }
+
+   //! Polynomial to pre-filter hard edges for an explicit normalised phase increment
+   static float polyBLEP(float t, float dt_)
    {
-      if (t < dt)
+      if (t < dt_)
       {
-         t = t / dt;
+         t = t / dt_;
          return t + t - t * t - 1.0f;
       }
-      else if (t > (1.0f - dt))
+      else if (t > (1.0f - dt_))
       {
-         t = (t - 1.0f) / dt;
+         t = (t - 1.0f) / dt_;
          return t + t + t*t + 1.0f;
       }
 
       return 0.0f;
    }
 
-   volatile UPhase phase{0}; //!< UPhase     (x2pi) Q0.32
-   volatile UPhase delta{0}; //!< UPhase inc (x2pi) Q0.32
+   UPhase phase{0}; //!< UPhase     (x2pi) Q0.32
+   UPhase delta{0}; //!< UPhase inc (x2pi) Q0.32
+   float  dt{};     //!< Phase increment normalised to 0.0..1.0
 
 private:
+   //! Parameters passed from the control side to the rendering side
+   struct Params
+   {
+      UPhase   delta{0};
+      UPhase   phase{0};
+      uint32_t delta_seq{0}; //!< Incremented for each frequency change
+      uint32_t phase_seq{0}; //!< Incremented for each phase change
+      uint32_t exp_freq{0};
+   };
+
    void updateExpFreq()
    {
-      exp_freq = (midi_note << EXP_FREQ_FRAC_BITS) + exp_freq_detune;
-      setDelta(noteLookup_7(exp_freq));
+      ctrl.exp_freq = (midi_note << EXP_FREQ_FRAC_BITS) + exp_freq_detune;
+      ctrl.delta    = noteLookup_7(ctrl.exp_freq);
+      ctrl.delta_seq++;
+      mailbox.post(ctrl);
+   }
+
+   void fetchParams()
+   {
+      Params params;
+
+      if (not mailbox.fetch(params))
+         return;
+
+      // A phase change alone leaves any modulated delta in place
+      if (params.delta_seq != delta_seq)
+      {
+         applyDelta(params.delta);
+         delta_seq = params.delta_seq;
+
+         // Posted delta has no modulation, so the next setMod() must re-apply it
+         exp_freq     = params.exp_freq;
+         mod_exp_freq = exp_freq;
+      }
+
+      if (params.phase_seq != phase_seq)
+      {
+         phase     = params.phase;
+         phase_seq = params.phase_seq;
+      }
    }
 
    static const unsigned EXP_FREQ_FRAC_BITS = 7;
    static const unsigned EXP_FREQ_SCALE     = 1 << EXP_FREQ_FRAC_BITS;
 
-   uint32_t exp_freq;           //!< Exponential frequency where 69.0 equivalent to 440 Hz (fixed-point-7)
-   int32_t  exp_freq_detune{0}; //!< Detune (fixed-point-7)
-   uint8_t  midi_note{0};       //!< MIDI note
-   float    dt{};
+   // Control side
+   Params           ctrl{};
+   Mailbox<Params>  mailbox{};
+   int32_t          exp_freq_detune{0}; //!< Detune (fixed-point-7)
+   uint8_t          midi_note{0};       //!< MIDI note
+
+   // Rendering side
+   uint32_t exp_freq{0};     //!< Exponential frequency where 69.0 equivalent to 440 Hz (fixed-point-7)
+   uint32_t mod_exp_freq{0}; //!< Exponential frequency including modulation (fixed-point-7)
+   uint32_t delta_seq{0};    //!< Last frequency change applied
+   uint32_t phase_seq{0};    //!< Last phase change applied
 };
 
 } // namespace SIG::osc
@@ -16,16 +16,35 @@ public:
 
    Signal operator()()
    {
-      noise_state ^= noise_state << 13;
-      noise_state ^= noise_state >> 17;
-      noise_state ^= noise_state << 5;
+      return gain(sample(noise_state));
+   }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      const Gain g     = gain;
+      uint32_t   state = noise_state;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(state));
+      }
 
-      return gain(Signal(int32_t(noise_state)) / Signal(0x7FFFFFFF));
+      noise_state = state;
    }
 
    Gain gain{};
 
 private:
+   static Signal sample(uint32_t& state_)
+   {
+      state_ ^= state_ << 13;
+      state_ ^= state_ >> 17;
+      state_ ^= state_ << 5;
+
+      return Signal(int32_t(state_)) / Signal(0x7FFFFFFF);
+   }
+
    uint32_t noise_state{1};
 };
 
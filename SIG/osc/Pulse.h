@@ -36,24 +36,9 @@ public:
 
    Signal operator()()
    {
-      unsigned index = phase >> (sizeof(UPhase) * 8 - LOG2_PATTERN_LENGTH);
+      receive();
 
-      delay[2] = delay[1];
-      delay[1] = delay[0];
-      delay[0] = pattern[index];
-
-      Signal signal = delay[1] ? +1.0f : -1.0f;
-
-      if ((not delay[0] && delay[1]) || (delay[1] && not delay[2]))
-      {
-         float t = uphase2float(phase);
-         signal += polyBLEP(t);
-      }
-      else if ((delay[0] && not delay[1]) || (not delay[1] && delay[2]))
-      {
-         float t = uphase2float(phase);
-         signal -= polyBLEP(t);
-      }
+      Signal signal = sample(phase, dt, delay);
 
       phase += delta;
 
@@ -62,33 +47,90 @@ public:
 
    Signal operator()(Signal mod_)
    {
-      setDelta(modDelta(mod_));
+      receive();
 
-      unsigned index = phase >> (sizeof(UPhase) * 8 - LOG2_PATTERN_LENGTH);
+      applyDelta(modDelta(mod_));
 
-      delay[2] = delay[1];
-      delay[1] = delay[0];
-      delay[0] = pattern[index];
+      Signal signal = sample(phase, dt, delay);
 
-      Signal signal = delay[1] ? +1.0f : -1.0f;
+      phase += delta;
 
-      if ((not delay[0] && delay[1]) || (delay[1] && not delay[2]))
+      return gain(signal);
+   }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const float  w = dt;
+      const UPhase d = delta;
+      UPhase       p = phase;
+      bool         z[3] = {delay[0], delay[1], delay[2]};
+
+      for(unsigned i = 0; i < n_; ++i)
       {
-         float t = uphase2float(phase);
-         signal += polyBLEP(t);
+         out_[i] = g(sample(p, w, z));
+         p += d;
       }
-      else if ((delay[0] && not delay[1]) || (not delay[1] && delay[2]))
+
+      delay[0] = z[0];
+      delay[1] = z[1];
+      delay[2] = z[2];
+      phase    = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain g = gain;
+      UPhase     p = phase;
+      UPhase     d = delta;
+      bool       z[3] = {delay[0], delay[1], delay[2]};
+
+      for(unsigned i = 0; i < n_; ++i)
       {
-         float t = uphase2float(phase);
-         signal -= polyBLEP(t);
+         d = modDelta(mod_[i]);
+         out_[i] = g(sample(p, uphase2float(d), z));
+         p += d;
       }
 
-      phase += delta;
-
-      return gain(signal);
+      delay[0] = z[0];
+      delay[1] = z[1];
+      delay[2] = z[2];
+      applyDelta(d);
+      phase = p;
    }
 
 private:
+   //! Advance the pattern pipeline and return the next band-limited sample
+   Signal sample(UPhase phase_, float dt_, bool* delay_) const
+   {
+      unsigned index = phase_ >> (sizeof(UPhase) * 8 - LOG2_PATTERN_LENGTH);
+
+      delay_[2] = delay_[1];
+      delay_[1] = delay_[0];
+      delay_[0] = pattern[index];
+
+      Signal signal = delay_[1] ? +1.0f : -1.0f;
+
+      if ((not delay_[0] && delay_[1]) || (delay_[1] && not delay_[2]))
+      {
+         float t = uphase2float(phase_);
+         signal += polyBLEP(t, dt_);
+      }
+      else if ((delay_[0] && not delay_[1]) || (not delay_[1] && delay_[2]))
+      {
+         float t = uphase2float(phase_);
+         signal -= polyBLEP(t, dt_);
+      }
+
+      return signal;
+   }
+
    static const unsigned LOG2_PATTERN_LENGTH = 5;
    static const uint64_t PATTERN_LENGTH      = 1 << LOG2_PATTERN_LENGTH;
 
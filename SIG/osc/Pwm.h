@@ -23,12 +23,9 @@ public:
 
    Signal operator()()
    {
-      Signal signal = phase < limit ? HIGH : LOW;
+      receive();
 
-      float t = uphase2float(phase);
-      signal += polyBLEP(t);
-      t = uphase2float(phase - limit);
-      signal -= polyBLEP(t);
+      Signal signal = sample(phase, dt, limit);
 
       phase += delta;
 
@@ -37,21 +34,71 @@ public:
 
    Signal operator()(Signal mod_)
    {
-      setDelta(modDelta(mod_));
+      receive();
 
-      Signal signal = phase < limit ? HIGH : LOW;
+      applyDelta(modDelta(mod_));
 
-      float t = uphase2float(phase);
-      signal += polyBLEP(t);
-      t = uphase2float(phase - limit);
-      signal -= polyBLEP(t);
+      Signal signal = sample(phase, dt, limit);
 
       phase += delta;
 
       return gain(signal);
    }
 
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const float  w = dt;
+      const UPhase d = delta;
+      const UPhase l = limit;
+      UPhase       p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p, w, l));
+         p += d;
+      }
+
+      phase = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const UPhase l = limit;
+      UPhase       p = phase;
+      UPhase       d = delta;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         d = modDelta(mod_[i]);
+         out_[i] = g(sample(p, uphase2float(d), l));
+         p += d;
+      }
+
+      applyDelta(d);
+      phase = p;
+   }
+
 private:
+   static Signal sample(UPhase phase_, float dt_, UPhase limit_)
+   {
+      Signal signal = phase_ < limit_ ? HIGH : LOW;
+
+      float t = uphase2float(phase_);
+      signal += polyBLEP(t, dt_);
+      t = uphase2float(phase_ - limit_);
+      signal -= polyBLEP(t, dt_);
+
+      return signal;
+   }
+
    UPhase limit{UPHASE_HALF};
 };
 
@@ -16,10 +16,9 @@ public:
 
    Signal operator()()
    {
-      Signal signal = uphase2signal(phase);
+      receive();
 
-      float t = uphase2float(phase - UPHASE_HALF);
-      signal -= polyBLEP(t);
+      Signal signal = sample(phase, dt);
 
       phase += delta;
 
@@ -28,17 +27,66 @@ public:
 
    Signal operator()(Signal mod_)
    {
-      setDelta(modDelta(mod_));
+      receive();
 
-      Signal signal = uphase2signal(phase);
+      applyDelta(modDelta(mod_));
 
-      float t = uphase2float(phase - UPHASE_HALF);
-      signal -= polyBLEP(t);
+      Signal signal = sample(phase, dt);
 
       phase += delta;
 
       return gain(signal);
    }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const float  w = dt;
+      const UPhase d = delta;
+      UPhase       p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p, w));
+         p += d;
+      }
+
+      phase = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain g = gain;
+      UPhase     p = phase;
+      UPhase     d = delta;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         d = modDelta(mod_[i]);
+         out_[i] = g(sample(p, uphase2float(d)));
+         p += d;
+      }
+
+      applyDelta(d);
+      phase = p;
+   }
+
+private:
+   static Signal sample(UPhase phase_, float dt_)
+   {
+      Signal signal = uphase2signal(phase_);
+
+      float t = uphase2float(phase_ - UPHASE_HALF);
+      signal -= polyBLEP(t, dt_);
+
+      return signal;
+   }
 };
 
 } // namespace SIG::osc
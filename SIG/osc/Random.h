@@ -16,6 +16,8 @@ public:
 
    Signal operator()()
    {
+      receive();
+
       if (phase < last_phase)
          nextSample();
 
@@ -28,10 +30,12 @@ public:
 
    Signal operator()(Signal mod_)
    {
+      receive();
+
       if (phase < last_phase)
          nextSample();
 
-      setDelta(modDelta(mod_));
+      applyDelta(modDelta(mod_));
 
       last_phase = phase;
 
@@ -40,6 +44,58 @@ public:
       return gain(signal);
    }
 
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g    = gain;
+      const UPhase d    = delta;
+      UPhase       p    = phase;
+      UPhase       last = last_phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         if (p < last)
+            nextSample();
+
+         last = p;
+         p   += d;
+
+         out_[i] = g(signal);
+      }
+
+      last_phase = last;
+      phase      = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain g    = gain;
+      UPhase     p    = phase;
+      UPhase     d    = delta;
+      UPhase     last = last_phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         if (p < last)
+            nextSample();
+
+         d    = modDelta(mod_[i]);
+         last = p;
+         p   += d;
+
+         out_[i] = g(signal);
+      }
+
+      applyDelta(d);
+      last_phase = last;
+      phase      = p;
+   }
+
 private:
    void nextSample()
    {
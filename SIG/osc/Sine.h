@@ -20,29 +20,70 @@ public:
 
    Signal operator()()
    {
-      float theta = uphase2signal(phase) * float(M_PI);
+      receive();
+
+      Signal signal = sample(phase);
 
       phase += delta;
 
-#if defined(SIG_FL32)
-      return gain(sinf(theta));
-#elif defined(SIG_FL64)
-      return gain(sin(theta));
-#else
-      return 0;
-#endif
+      return gain(signal);
    }
 
    Signal operator()(Signal mod_)
    {
-      float theta = uphase2signal(phase) * float(M_PI);
+      receive();
+
+      Signal signal = sample(phase);
 
       phase += modDelta(mod_);
 
+      return gain(signal);
+   }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const UPhase d = delta;
+      UPhase       p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p));
+         p += d;
+      }
+
+      phase = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain g = gain;
+      UPhase     p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p));
+         p += modDelta(mod_[i]);
+      }
+
+      phase = p;
+   }
+
+private:
+   static Signal sample(UPhase phase_)
+   {
+      float theta = uphase2signal(phase_) * float(M_PI);
+
 #if defined(SIG_FL32)
-      return gain(sinf(theta));
+      return sinf(theta);
 #elif defined(SIG_FL64)
-      return gain(sin(theta));
+      return sin(theta);
 #else
       return 0;
 #endif
@@ -16,12 +16,9 @@ public:
 
    Signal operator()()
    {
-      UPhase phase_shift = phase + UPHASE_QUARTER;
+      receive();
 
-      UPhase p = phase_shift >= UPHASE_HALF ? -phase * 2
-                                          : +phase * 2;
-
-      Signal signal = uphase2signal(p);
+      Signal signal = sample(phase);
 
       phase += delta;
 
@@ -30,17 +27,60 @@ public:
 
    Signal operator()(Signal mod_)
    {
-      UPhase phase_shift = phase + UPHASE_QUARTER;
-
-      UPhase p = phase_shift >= UPHASE_HALF ? -phase * 2
-                                          : +phase * 2;
+      receive();
 
-      Signal signal = uphase2signal(p);
+      Signal signal = sample(phase);
 
       phase += modDelta(mod_);
 
       return gain(signal);
    }
+
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain   g = gain;
+      const UPhase d = delta;
+      UPhase       p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p));
+         p += d;
+      }
+
+      phase = p;
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+
+      const Gain g = gain;
+      UPhase     p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(sample(p));
+         p += modDelta(mod_[i]);
+      }
+
+      phase = p;
+   }
+
+private:
+   static Signal sample(UPhase phase_)
+   {
+      UPhase phase_shift = phase_ + UPHASE_QUARTER;
+
+      UPhase p = phase_shift >= UPHASE_HALF ? -phase_ * 2
+                                            : +phase_ * 2;
+
+      return uphase2signal(p);
+   }
 };
 
 } // namespace SIG::osc
@@ -2,90 +2,299 @@
 // Copyright (c) 2025 John D. Haughton
 // SPDX-License-Identifier: MIT
 //-------------------------------------------------------------------------------
-   
+
 #pragma once
 
+#include <atomic>
+
 #include "Base.h"
 
 namespace SIG::osc {
 
-template <unsigned LOG2_SIZE = 10>
+//! Wave table lookup interpolation
+enum class Interp
+{
+   NONE,   //!< Truncate phase to table index
+   LINEAR, //!< Linear interpolation between adjacent entries
+   CUBIC   //!< 4-point Catmull-Rom interpolation
+};
+
+//! Wave table oscillator
+//
+//! With LEVELS > 1 a per-octave mip-map of band-limited tables is kept and
+//! the table used is selected from the current phase increment so that no
+//! harmonic in the selected table is above the Nyquist frequency.
+//!
+//! The tables are double buffered, computeWave() builds into the idle
+//! buffer and then swaps it in, so it may be run from a background thread
+//! or the other core while the oscillator is rendering. The render side
+//! acknowledges the buffer it is reading and computeWave() refuses to
+//! build while the idle buffer may still be in use. Before the first
+//! render neither buffer is in use so every build goes ahead
+template <unsigned LOG2_SIZE = 10, unsigned LEVELS = 1>
 class WaveTable : public Base
 {
+   static_assert((LEVELS != 0) && (LEVELS <= LOG2_SIZE));
+
 public:
    WaveTable() = default;
 
+   //! Select lookup interpolation
+   void setInterp(Interp interp_) { interp = interp_; }
+
    Signal operator()()
    {
-      unsigned index = phase >> SHIFT;
+      receive();
+      takeTable();
+
+      Signal signal = lookup(level(delta), phase);
 
       phase += delta;
 
-      return gain(table[index]);
+      return gain(signal);
    }
 
    Signal operator()(Signal mod_)
    {
-      unsigned index = phase >> SHIFT;
+      receive();
+      takeTable();
+
+      UPhase d = modDelta(mod_);
+
+      Signal signal = lookup(level(d), phase);
 
-      phase += modDelta(mod_);
+      phase += d;
 
-      return gain(table[index]);
+      return gain(signal);
    }
 
-   void computeWave()
+   //! Render a block of samples
+   void process(Signal* out_, unsigned n_)
    {
-      Signal local[SIZE];
+      receive();
+      takeTable();
 
-      for(unsigned i = 0; i < SIZE; ++i)
+      switch(interp)
+      {
+      case Interp::NONE:   render<Interp::NONE>(out_, n_);   break;
+      case Interp::LINEAR: render<Interp::LINEAR>(out_, n_); break;
+      case Interp::CUBIC:  render<Interp::CUBIC>(out_, n_);  break;
+      }
+   }
+
+   //! Render a block of samples with a frequency modulation input
+   void process(const Signal* mod_, Signal* out_, unsigned n_)
+   {
+      receive();
+      takeTable();
+
+      const Gain g = gain;
+      UPhase     p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
       {
-         local[i] = wavetableSample(Float(i) / SIZE);
+         UPhase d = modDelta(mod_[i]);
+
+         out_[i] = g(lookup(level(d), p));
+         p += d;
       }
 
-      updateWave(local);
+      phase = p;
+   }
+
+   //! Build the tables and make them live
+   //
+   //! \return false if the render side has not yet moved to the tables
+   //!         from the previous call, try again later
+   [[nodiscard]] bool computeWave()
+   {
+      uint8_t current = ping_pong.load(std::memory_order_relaxed);
+      uint8_t held    = in_use.load(std::memory_order_seq_cst);
+
+      if ((held != NONE) && (held != current))
+         return false;
+
+      unsigned next = current ^ 1;
+      Signal   min{+1.0};
+      Signal   max{-1.0};
+
+      for(unsigned lvl = 0; lvl < LEVELS; ++lvl)
+      {
+         Signal* data = table[next][lvl];
+
+         bandLimitedTable(data, (SIZE / 2) >> lvl);
+
+         // All levels share the scaling of the full bandwidth table
+         if (lvl == 0)
+         {
+            for(unsigned i = 0; i < SIZE; ++i)
+            {
+               if(data[i] > max) max = data[i];
+               if(data[i] < min) min = data[i];
+            }
+         }
+
+         rescaleWave(data, min, max);
+      }
+
+      updateWave(next);
+      return true;
    }
 
    const Signal* getTable(size_t& size) const
    {
       size = SIZE;
-      return table;
+      return table[ping_pong.load(std::memory_order_acquire)][0];
    }
 
 protected:
    virtual Signal wavetableSample(Float t) = 0;
 
-private:
-   //! Rewrite wave tabel with new data
-   void updateWave(Signal* data)
+   //! Sample containing no harmonics above the given limit
+   //
+   //! Override to provide band-limited mip-map levels, the default
+   //! implementation ignores the limit
+   virtual Signal bandLimitedSample(Float t, unsigned harmonics_)
    {
-      Signal min = +1.0;
-      Signal max = -1.0;
+      return wavetableSample(t);
+   }
 
+   //! Fill a whole table containing no harmonics above the given limit
+   //
+   //! Override where a table can be built faster than sample by sample
+   virtual void bandLimitedTable(Signal* data_, unsigned harmonics_)
+   {
       for(unsigned i = 0; i < SIZE; ++i)
       {
-         Signal value = data[i];
+         data_[i] = bandLimitedSample(Float(i) / SIZE, harmonics_);
+      }
+   }
+
+   static constexpr unsigned SIZE = 1 << LOG2_SIZE;
+
+private:
+   //! Mip-map level for a phase increment
+   static unsigned level(UPhase delta_)
+   {
+      if constexpr (LEVELS == 1)
+      {
+         return 0;
+      }
+      else
+      {
+         UPhase steps = delta_ >> SHIFT;
+
+         unsigned lvl = steps == 0 ? 0 : 32 - __builtin_clz(steps);
+
+         return lvl < LEVELS ? lvl : LEVELS - 1;
+      }
+   }
+
+   Signal lookup(unsigned level_, UPhase phase_) const
+   {
+      const Signal* t = table[live][level_];
+
+      switch(interp)
+      {
+      case Interp::NONE:   return lookup<Interp::NONE>(t, phase_);
+      case Interp::LINEAR: return lookup<Interp::LINEAR>(t, phase_);
+      case Interp::CUBIC:  return lookup<Interp::CUBIC>(t, phase_);
+      }
+
+      return 0;
+   }
 
-         if(value > max) max = value;
-         if(value < min) min = value;
+   template <Interp INTERP>
+   static Signal lookup(const Signal* table_, UPhase phase_)
+   {
+      unsigned index = phase_ >> SHIFT;
+
+      if constexpr (INTERP == Interp::NONE)
+      {
+         return table_[index];
       }
+      else
+      {
+         Signal frac = uphase2float(phase_ << LOG2_SIZE);
+         Signal y1   = table_[index];
+         Signal y2   = table_[(index + 1) & MASK];
+
+         if constexpr (INTERP == Interp::LINEAR)
+         {
+            return y1 + (y2 - y1) * frac;
+         }
+         else
+         {
+            Signal y0 = table_[(index - 1) & MASK];
+            Signal y3 = table_[(index + 2) & MASK];
 
-      // Rescale to -1..+1
+            Signal c1 = Signal(0.5) * (y2 - y0);
+            Signal c2 = y0 - Signal(2.5) * y1 + Signal(2.0) * y2 - Signal(0.5) * y3;
+            Signal c3 = Signal(0.5) * (y3 - y0) + Signal(1.5) * (y1 - y2);
+
+            return ((c3 * frac + c2) * frac + c1) * frac + y1;
+         }
+      }
+   }
+
+   template <Interp INTERP>
+   void render(Signal* out_, unsigned n_)
+   {
+      const Gain    g = gain;
+      const UPhase  d = delta;
+      const Signal* t = table[live][level(d)];
+      UPhase        p = phase;
+
+      for(unsigned i = 0; i < n_; ++i)
+      {
+         out_[i] = g(lookup<INTERP>(t, p));
+         p += d;
+      }
+
+      phase = p;
+   }
+
+   //! Rescale wave data from min..max to -1..+1
+   static void rescaleWave(Signal* data, Signal min, Signal max)
+   {
       for(unsigned i = 0; i < SIZE; ++i)
       {
          data[i] = (2.0 * (data[i] - min) / (max - min)) - 1.0;
       }
+   }
 
-      // Final copy to live wave table
-      for(unsigned i = 0; i < SIZE; ++i)
+   //! Move to the live tables and acknowledge them (render side)
+   //
+   //! Only a load unless computeWave() has made new tables live. The
+   //! acknowledgement is checked against a further swap that it may have
+   //! raced with, so computeWave() can never build into the tables read
+   void takeTable()
+   {
+      uint8_t index = ping_pong.load(std::memory_order_acquire);
+
+      while(index != live)
       {
-         table[i] = data[i];
+         in_use.store(index, std::memory_order_seq_cst);
+         live  = index;
+         index = ping_pong.load(std::memory_order_seq_cst);
       }
    }
 
-   static constexpr unsigned SIZE      = 1 << LOG2_SIZE;
+   //! Make a newly written set of tables live
+   void updateWave(unsigned next_)
+   {
+      ping_pong.store(next_, std::memory_order_seq_cst);
+   }
+
+   static constexpr unsigned MASK      = SIZE - 1;
    static constexpr unsigned SHIFT     = sizeof(UPhase) * 8 - LOG2_SIZE;
+   static constexpr uint8_t  NONE      = 2; //!< No table taken yet
 
-   Signal table[SIZE];
+   Interp               interp{Interp::NONE};
+   Signal               table[2][LEVELS][SIZE];
+   std::atomic<uint8_t> ping_pong{0};
+   std::atomic<uint8_t> in_use{NONE}; //!< Buffer held by the render side
+   uint8_t              live{NONE};   //!< Buffer read (render side)
 };
 
 } // namespace SIG::osc
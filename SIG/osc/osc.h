@@ -6,6 +6,7 @@
 #pragma once
 
 #include "Additive.h"
+#include "Bank.h"
 #include "Noise.h"
 #include "Pulse.h"
 #include "Pwm.h"
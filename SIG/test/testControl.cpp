@@ -0,0 +1,250 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/Control.h"
+#include "SIG/ExpSlew.h"
+#include "SIG/LinSlew.h"
+#include "SIG/env/Adsr.h"
+#include "SIG/env/Lfo.h"
+#include "SIG/filter/BiQuad.h"
+#include "SIG/osc/Ramp.h"
+#include "SIG/osc/Square.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+TEST(SIG_Control, periods_span_blocks)
+{
+   Control<32> control;
+
+   unsigned updates  = 0;
+   unsigned rendered = 0;
+
+   // Block sizes that are not a multiple of the control period
+   for(unsigned block = 0; block < 8; ++block)
+   {
+      control.process(20,
+                      [&]()
+                      {
+                         EXPECT_EQ(updates * 32, rendered);
+                         ++updates;
+                      },
+                      [&](unsigned offset_, unsigned n_)
+                      {
+                         EXPECT_EQ(rendered % 20, offset_);
+                         rendered += n_;
+                      });
+   }
+
+   EXPECT_EQ(160, rendered);
+   EXPECT_EQ(5, updates);
+}
+
+TEST(SIG_Control, slew_advance)
+{
+   LinSlew lin{SAMPLE_RATE / 64};
+   LinSlew lin_ref{SAMPLE_RATE / 64};
+   ExpSlew exp{0.001};
+   ExpSlew exp_ref{0.001};
+
+   lin     = Signal{1.0};
+   lin_ref = Signal{1.0};
+   exp     = Signal{1.0};
+   exp_ref = Signal{1.0};
+
+   for(unsigned period = 0; period < 4; ++period)
+   {
+      for(unsigned i = 0; i < 7; ++i)
+      {
+         lin_ref();
+         exp_ref();
+      }
+
+      EXPECT_NEAR(lin_ref(), lin.advance(8), 0.0001);
+      EXPECT_NEAR(exp_ref(), exp.advance(8), 0.0001);
+   }
+}
+
+TEST(SIG_Control, env_advance)
+{
+   env::Adsr adsr;
+   env::Adsr adsr_ref;
+   env::Lfo  lfo;
+   env::Lfo  lfo_ref;
+
+   for(env::Adsr* env : {&adsr, &adsr_ref})
+   {
+      env->setAttack_mS(2);
+      env->setDecay_mS(3);
+      env->setSustain(Float(0.5));
+      env->setRelease_mS(2);
+      env->on();
+   }
+
+   for(env::Lfo* env : {&lfo, &lfo_ref})
+   {
+      env->setDelay(0.001);
+      env->setAttack(0.002);
+      env->on();
+   }
+
+   Signal adsr_value{};
+   Signal lfo_value{};
+
+   for(unsigned period = 0; period < 16; ++period)
+   {
+      if (period == 10)
+      {
+         adsr.off();
+         adsr_ref.off();
+      }
+
+      for(unsigned i = 0; i < 32; ++i)
+      {
+         adsr_value = adsr_ref();
+         lfo_value  = lfo_ref();
+      }
+
+      EXPECT_NEAR(adsr_value, adsr.advance(32), 0.0001);
+      EXPECT_NEAR(lfo_value,  lfo.advance(32),  0.0001);
+   }
+}
+
+TEST(SIG_Control, osc_mod)
+{
+   osc::Square osc;
+   osc::Square ref;
+
+   osc.setNote(60);
+   ref.setNote(60);
+
+   Signal mod[32];
+   Signal out[32];
+   Signal expect[32];
+
+   for(unsigned i = 0; i < 32; ++i)
+      mod[i] = 2.5;
+
+   osc.setMod(2.5);
+   osc.process(out, 32);
+   ref.process(mod, expect, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      EXPECT_EQ(expect[i], out[i]);
+   }
+}
+
+TEST(SIG_Control, osc_mod_sync)
+{
+   osc::Ramp osc;
+   osc::Ramp ref;
+
+   osc.setNote(60);
+   ref.setNote(60);
+
+   Signal mod[32];
+   Signal out[32];
+   Signal expect[32];
+
+   for(unsigned i = 0; i < 32; ++i)
+      mod[i] = 2.5;
+
+   // A phase change alone keeps the modulated frequency
+   osc.setMod(2.5);
+   osc.sync();
+   osc.process(out, 32);
+
+   ref.sync();
+   ref.process(mod, expect, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      EXPECT_EQ(expect[i], out[i]);
+   }
+
+   // A frequency change drops the modulation
+   osc.setNote(62);
+   ref.setNote(62);
+
+   osc.process(out, 32);
+   ref.process(expect, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      EXPECT_EQ(expect[i], out[i]);
+   }
+}
+
+TEST(SIG_Control, osc_copy)
+{
+   osc::Ramp osc;
+
+   osc.setNote(60);
+
+   Signal out[32];
+   Signal expect[32];
+
+   osc.process(out, 8);
+
+   // Copy with a post still pending
+   osc.setNote(64);
+
+   osc::Ramp copy{osc};
+
+   osc.process(expect, 32);
+   copy.process(out, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      EXPECT_EQ(expect[i], out[i]);
+   }
+}
+
+TEST(SIG_Control, biquad_ramp)
+{
+   filter::BiQuad filter{filter::LOPASS};
+   filter::BiQuad ref{filter::LOPASS};
+
+   filter.setFreq(1000.0);
+   ref.setFreq(1000.0);
+
+   Signal block[32];
+
+   // First ramped block moves from the initial coefficients, so prime it
+   for(unsigned i = 0; i < 32; ++i)
+      block[i] = 0.0;
+
+   filter.processRamp(block, block, 32);
+
+   // Constant coefficients match the un-ramped filter
+   for(unsigned i = 0; i < 32; ++i)
+      block[i] = (i & 4) ? +1.0 : -1.0;
+
+   filter.processRamp(block, block, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      EXPECT_NEAR(ref((i & 4) ? +1.0 : -1.0), block[i], 0.0001);
+   }
+
+   // A change reaches the new coefficients by the end of the block
+   filter.setFreq(2000.0);
+   ref.setFreq(2000.0);
+
+   for(unsigned i = 0; i < 32; ++i)
+      block[i] = 0.0;
+
+   filter.processRamp(block, block, 32);
+
+   filter.zero();
+   ref.zero();
+
+   block[0] = 1.0;
+   filter.processRamp(block, block, 1);
+
+   EXPECT_NEAR(ref(1.0), block[0], 0.0001);
+}
@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/Convolve.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+static const unsigned IR_LENGTH = 1000;
+static const unsigned N         = 4000;
+
+//! Repeatable noise in the range -1.0..1.0
+static Signal noise(uint32_t& state_)
+{
+   state_ = state_ * 1664525 + 1013904223;
+   return Signal(int32_t(state_)) / Signal(0x80000000);
+}
+
+TEST(SIG_Convolve, direct)
+{
+   static Convolve<6, 16> conv;
+
+   static Signal ir[IR_LENGTH];
+   static Signal in[N];
+   static Signal out[N];
+
+   uint32_t state = 1;
+
+   for(unsigned i = 0; i < IR_LENGTH; ++i)
+      ir[i] = noise(state) * Signal(1.0 - double(i) / IR_LENGTH);
+
+   for(unsigned i = 0; i < N; ++i)
+      in[i] = noise(state);
+
+   conv.setIR(ir, IR_LENGTH);
+
+   // Blocks of uneven size
+   for(unsigned i = 0, n = 1; i < N; i += n, n = n % 97 + 13)
+   {
+      if ((i + n) > N) n = N - i;
+
+      conv.process(&in[i], &out[i], n);
+   }
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      double expect = 0.0;
+
+      if (i >= conv.LATENCY)
+      {
+         unsigned t = i - conv.LATENCY;
+
+         for(unsigned k = 0; k < IR_LENGTH && k <= t; ++k)
+            expect += ir[k] * in[t - k];
+      }
+
+      EXPECT_NEAR(expect, out[i], 0.001);
+   }
+}
+
+TEST(SIG_Convolve, impulse)
+{
+   static Convolve<4, 4> conv;
+
+   Signal ir[] = {0.5, 0.0, -0.25};
+
+   conv.setIR(ir, 3);
+
+   for(unsigned i = 0; i < 40; ++i)
+   {
+      Signal y = conv(i == 0 ? 1.0 : 0.0);
+
+      Signal expect = i == 16 ? 0.5 : i == 18 ? -0.25 : 0.0;
+
+      EXPECT_NEAR(expect, y, 0.00001);
+   }
+}
@@ -41,3 +41,26 @@ TEST(SIG_DelayN, usage)
     EXPECT_EQ(0.0, delay(15.0));
     EXPECT_EQ(13.0, delay(16.0));
 }
+
+TEST(SIG_DelayN, block)
+{
+   DelayN<3> delay{};
+
+   Signal in[5]  = {1.0, 2.0, 3.0, 4.0, 5.0};
+   Signal out[5];
+
+   delay.process(in, out, 5);
+
+   EXPECT_EQ(0.0, out[0]);
+   EXPECT_EQ(0.0, out[1]);
+   EXPECT_EQ(0.0, out[2]);
+   EXPECT_EQ(1.0, out[3]);
+   EXPECT_EQ(2.0, out[4]);
+
+   // In place
+   delay.process(in, in, 2);
+
+   EXPECT_EQ(3.0, in[0]);
+   EXPECT_EQ(4.0, in[1]);
+   EXPECT_EQ(5.0, delay());
+}
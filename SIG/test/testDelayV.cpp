@@ -93,3 +93,24 @@ TEST(SIG_DelayV, reset_restores_default_state)
    EXPECT_EQ(0.0, delay(8.0));
    EXPECT_EQ(5.0, delay(9.0));
 }
+
+TEST(SIG_DelayV, block_length_change_applies_on_wrap)
+{
+   DelayV<4> delay{};
+
+   delay.setLength(2);
+
+   Signal in[8]  = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+   Signal out[8];
+
+   delay.process(in, out, 8);
+
+   EXPECT_EQ(0.0, out[0]);
+   EXPECT_EQ(0.0, out[3]);
+   EXPECT_EQ(1.0, out[4]);
+   EXPECT_EQ(2.0, out[5]);
+   EXPECT_EQ(5.0, out[6]);
+   EXPECT_EQ(6.0, out[7]);
+
+   EXPECT_EQ(2, delay.size());
+}
@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/FFT.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+TEST(SIG_FFT, forward_single_bin)
+{
+   const unsigned N = FFT<6>::SIZE;
+
+   Float re[N];
+   Float im[N];
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      re[i] = cos(2 * M_PI * 5 * i / N);
+      im[i] = 0.0;
+   }
+
+   FFT<6>::forward(re, im);
+
+   for(unsigned k = 0; k < N; ++k)
+   {
+      double expect = (k == 5) || (k == N - 5) ? N / 2 : 0.0;
+
+      EXPECT_NEAR(expect, re[k], 0.0001);
+      EXPECT_NEAR(0.0,    im[k], 0.0001);
+   }
+}
+
+TEST(SIG_FFT, round_trip)
+{
+   const unsigned N = FFT<8>::SIZE;
+
+   Float re[N];
+   Float im[N];
+   Float ref[N];
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      ref[i] = Float((i * 37) % 11) - 5.0;
+      re[i]  = ref[i];
+      im[i]  = 0.0;
+   }
+
+   FFT<8>::forward(re, im);
+   FFT<8>::inverse(re, im);
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      EXPECT_NEAR(ref[i], re[i] / N, 0.0001);
+      EXPECT_NEAR(0.0,    im[i] / N, 0.0001);
+   }
+}
+
+TEST(SIG_FFT, odd_size)
+{
+   const unsigned N = FFT<7>::SIZE;
+
+   Float re[N];
+   Float im[N];
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      re[i] = cos(2 * M_PI * 3 * i / N);
+      im[i] = sin(2 * M_PI * 3 * i / N);
+   }
+
+   FFT<7>::forward(re, im);
+
+   for(unsigned k = 0; k < N; ++k)
+   {
+      EXPECT_NEAR(k == 3 ? N : 0.0, re[k], 0.0001);
+      EXPECT_NEAR(0.0,              im[k], 0.0001);
+   }
+}
+
+TEST(SIG_FFT, real)
+{
+   const unsigned N = FFT<9>::SIZE;
+
+   Float x[N];
+   Float re[N];
+   Float im[N];
+   Float real_re[N / 2 + 1];
+   Float real_im[N / 2 + 1];
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      x[i]  = Float((i * 37) % 11) - 5.0;
+      re[i] = x[i];
+      im[i] = 0.0;
+   }
+
+   FFT<9>::forward(re, im);
+   FFT<9>::forwardReal(x, real_re, real_im);
+
+   for(unsigned k = 0; k <= N / 2; ++k)
+   {
+      EXPECT_NEAR(re[k], real_re[k], 0.01);
+      EXPECT_NEAR(im[k], real_im[k], 0.01);
+   }
+
+   Float y[N];
+
+   FFT<9>::inverseReal(real_re, real_im, y);
+
+   for(unsigned i = 0; i < N; ++i)
+   {
+      EXPECT_NEAR(x[i], y[i] / N, 0.0001);
+   }
+}
@@ -22,3 +22,17 @@ TEST(SIG_Gain, usage)
    EXPECT_NEAR(1.0,  gain(2.0), 0.0001);
    EXPECT_NEAR(-1.5, gain(-3.0), 0.0001);
 }
+
+TEST(SIG_Gain, block)
+{
+   Gain gain{0.5};
+
+   Signal in[3] = {2.0, -3.0, 0.0};
+   Signal out[3];
+
+   gain.process(in, out, 3);
+
+   EXPECT_NEAR(1.0,  out[0], 0.0001);
+   EXPECT_NEAR(-1.5, out[1], 0.0001);
+   EXPECT_NEAR(0.0,  out[2], 0.0001);
+}
@@ -33,3 +33,20 @@ TEST(SIG_LinSlew, set_bypasses_slew)
    EXPECT_NEAR(2.0, slew(), 0.0001);
    EXPECT_NEAR(6.0, slew(3.0), 0.0001);
 }
+
+TEST(SIG_LinSlew, block)
+{
+   LinSlew slew{SAMPLE_RATE / 4};
+
+   slew.set(0.0);
+   slew = Signal{1.0};
+
+   Signal out[4];
+
+   slew.process(out, 4);
+
+   EXPECT_NEAR(0.25, out[0], 0.0001);
+   EXPECT_NEAR(0.50, out[1], 0.0001);
+   EXPECT_NEAR(0.75, out[2], 0.0001);
+   EXPECT_NEAR(1.00, out[3], 0.0001);
+}
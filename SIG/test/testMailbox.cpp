@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <thread>
+
+#include "SIG/Mailbox.h"
+#include "SIG/osc/Sine.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+namespace {
+
+struct Pair
+{
+   uint32_t value;
+   uint32_t check;
+   uint8_t  tag;
+};
+
+}
+
+TEST(SIG_Mailbox, latest)
+{
+   Mailbox<Pair> mailbox;
+   Pair          pair{};
+
+   EXPECT_FALSE(mailbox.pending());
+   EXPECT_FALSE(mailbox.fetch(pair));
+
+   mailbox.post({1, ~1u, 'a'});
+   mailbox.post({2, ~2u, 'b'});
+
+   EXPECT_TRUE(mailbox.pending());
+   EXPECT_TRUE(mailbox.fetch(pair));
+   EXPECT_EQ(2u,  pair.value);
+   EXPECT_EQ('b', pair.tag);
+
+   EXPECT_FALSE(mailbox.pending());
+   EXPECT_FALSE(mailbox.fetch(pair));
+}
+
+TEST(SIG_Mailbox, threads)
+{
+   static const uint32_t LAST = 200000;
+
+   Mailbox<Pair> mailbox;
+
+   std::thread writer([&]()
+                      {
+                         for(uint32_t i = 1; i <= LAST; ++i)
+                            mailbox.post({i, ~i, uint8_t(i)});
+                      });
+
+   uint32_t prev = 0;
+   bool     torn = false;
+
+   while(prev != LAST)
+   {
+      Pair pair;
+
+      if (mailbox.fetch(pair))
+      {
+         torn |= (pair.check != ~pair.value) || (pair.tag != uint8_t(pair.value));
+         torn |= pair.value <= prev;
+         prev  = pair.value;
+      }
+   }
+
+   writer.join();
+
+   EXPECT_FALSE(torn);
+}
+
+TEST(SIG_Mailbox, osc_params)
+{
+   osc::Sine osc;
+   Signal    block[16];
+
+   osc.setDelta(1000);
+   osc.setPhase(5);
+
+   // Nothing is applied until the oscillator renders
+   EXPECT_EQ(0u, osc.getPhase());
+
+   osc.process(block, 16);
+   EXPECT_EQ(5u + 16 * 1000, osc.getPhase());
+
+   // A later delta change keeps the current phase
+   osc.setDelta(10);
+   osc.process(block, 16);
+   EXPECT_EQ(5u + 16 * 1000 + 16 * 10, osc.getPhase());
+
+   osc.sync();
+   osc();
+   EXPECT_EQ(10u, osc.getPhase());
+}
@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "SIG/Resample.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+static const unsigned N = 8820; //!< 200 ms at 44.1 kHz
+
+//! Amplitude of one frequency in a block
+static double level(const Signal* x_, unsigned n_, double freq_, unsigned rate_)
+{
+   double re = 0.0;
+   double im = 0.0;
+
+   for(unsigned i = 0; i < n_; ++i)
+   {
+      double theta = 2 * M_PI * freq_ * i / rate_;
+
+      re += x_[i] * cos(theta);
+      im += x_[i] * sin(theta);
+   }
+
+   return 2.0 * sqrt(re * re + im * im) / n_;
+}
+
+//! Convert a tone and return the output after the start-up transient
+static void convert(unsigned in_rate_, unsigned out_rate_, double freq_, Signal* out_,
+                    unsigned& pulled_)
+{
+   static Resample<> resample;
+
+   resample.setRates(in_rate_, out_rate_);
+
+   unsigned t = 0;
+
+   auto render = [&](Signal* in_, unsigned n_)
+                 {
+                    for(unsigned i = 0; i < n_; ++i, ++t)
+                       in_[i] = Signal(0.5 * sin(2 * M_PI * freq_ * t / in_rate_));
+                 };
+
+   // Skip the start-up transient
+   resample.process(out_, 1000, render);
+
+   unsigned start = t;
+   resample.process(out_, N, render);
+   pulled_ = t - start;
+}
+
+TEST(SIG_Resample, down)
+{
+   static Signal out[N];
+   unsigned      pulled;
+
+   convert(48000, 44100, 1000.0, out, pulled);
+
+   EXPECT_NEAR(0.5, level(out, N, 1000.0, 44100), 0.002);
+
+   // Source consumed at the source rate
+   EXPECT_NEAR(N * 48000.0 / 44100, double(pulled), 256.0);
+}
+
+TEST(SIG_Resample, up)
+{
+   static Signal out[N];
+   unsigned      pulled;
+
+   convert(44100, 48000, 1000.0, out, pulled);
+
+   EXPECT_NEAR(0.5, level(out, N, 1000.0, 48000), 0.002);
+   EXPECT_NEAR(N * 44100.0 / 48000, double(pulled), 256.0);
+}
+
+TEST(SIG_Resample, anti_alias)
+{
+   static Signal out[N];
+   unsigned      pulled;
+
+   // 23 kHz is above the output Nyquist frequency and would fold to 21.1 kHz
+   convert(48000, 44100, 23000.0, out, pulled);
+
+   EXPECT_GT(0.0005, level(out, N, 44100 - 23000.0, 44100));
+}
+
+TEST(SIG_Resample, passband)
+{
+   static Signal out[N];
+   unsigned      pulled;
+
+   convert(48000, 44100, 16000.0, out, pulled);
+
+   EXPECT_NEAR(0.5, level(out, N, 16000.0, 44100), 0.002);
+}
@@ -0,0 +1,97 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "SIG/Const.h"
+#include "SIG/clip/No.h"
+#include "SIG/clip/Oversample.h"
+#include "SIG/clip/Tanh.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+static const unsigned N = 4800; //!< Whole number of cycles for all test tones
+
+//! Amplitude of one frequency in a block, after the filter has settled
+static double level(const Signal* x_, unsigned n_, double freq_)
+{
+   double re = 0.0;
+   double im = 0.0;
+
+   for(unsigned i = 0; i < n_; ++i)
+   {
+      double theta = 2 * M_PI * freq_ * i / SAMPLE_RATE;
+
+      re += x_[i] * cos(theta);
+      im += x_[i] * sin(theta);
+   }
+
+   return 2.0 * sqrt(re * re + im * im) / n_;
+}
+
+template <typename CLIP, typename... ARGS>
+static void render(CLIP& clip_, double freq_, Signal* out_, ARGS... args_)
+{
+   // Run in first so that the filter history is full
+   for(unsigned i = 0; i < 2 * N; ++i)
+   {
+      Signal x = Signal(0.5 * sin(2 * M_PI * freq_ * i / SAMPLE_RATE));
+      Signal y = clip_(x, args_...);
+
+      if (i >= N)
+         out_[i - N] = y;
+   }
+}
+
+TEST(SIG_clip_oversample, passband)
+{
+   clip::Oversample<2, clip::No> x2;
+   clip::Oversample<4, clip::No> x4;
+   clip::Oversample<8, clip::No> x8;
+
+   static Signal out[N];
+
+   for(double freq : {100.0, 1000.0, 10000.0, 18000.0})
+   {
+      render(x2, freq, out);
+      EXPECT_NEAR(0.5, level(out, N, freq), 0.005);
+
+      render(x4, freq, out);
+      EXPECT_NEAR(0.5, level(out, N, freq), 0.005);
+
+      render(x8, freq, out);
+      EXPECT_NEAR(0.5, level(out, N, freq), 0.005);
+   }
+}
+
+TEST(SIG_clip_oversample, alias)
+{
+   // The 3rd harmonic of 15 kHz is 45 kHz, which folds back to 3 kHz
+   const double freq  = 15000.0;
+   const double alias = 3 * freq - SAMPLE_RATE;
+
+   clip::Tanh                      x1;
+   clip::Oversample<2, clip::Tanh> x2;
+   clip::Oversample<4, clip::Tanh> x4;
+
+   static Signal out[N];
+
+   render(x1, freq, out, Float(4.0));
+   double base = level(out, N, alias);
+
+   render(x2, freq, out, Float(4.0));
+   double over2 = level(out, N, alias);
+
+   render(x4, freq, out, Float(4.0));
+   double over4 = level(out, N, alias);
+
+   EXPECT_LT(0.05, base);
+
+   // At least 40 dB lower
+   EXPECT_GT(base / 100, over2);
+   EXPECT_GT(base / 100, over4);
+}
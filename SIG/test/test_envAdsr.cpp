@@ -32,3 +32,37 @@ TEST(SIG_env, adsr)
       // printf("%5u: %f\n", i, env());
    }
 }
+
+TEST(SIG_env, adsr_block)
+{
+   env::Adsr env{};
+   env::Adsr ref{};
+
+   for(auto* e : {&env, &ref})
+   {
+      e->setAttack_mS(1);
+      e->setDecay_mS(2);
+      e->setSustain(uint8_t(0x40));
+      e->setRelease_mS(3);
+      e->on();
+   }
+
+   const unsigned BLOCK = 32;
+   Signal         block[BLOCK];
+
+   for(unsigned b = 0; b < (SAMPLE_RATE / 1000) * 8 / BLOCK; ++b)
+   {
+      if (b == 6)
+      {
+         env.off();
+         ref.off();
+      }
+
+      env.process(block, BLOCK);
+
+      for(unsigned i = 0; i < BLOCK; ++i)
+      {
+         EXPECT_EQ(ref(), block[i]);
+      }
+   }
+}
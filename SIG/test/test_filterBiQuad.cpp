@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/filter/BiQuad.h"
+#include "SIG/filter/DualBiQuad.h"
+#include "SIG/filter/BiQuadCascade.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+TEST(SIG_filter, biquad_block)
+{
+   filter::BiQuad filter{filter::LOPASS};
+   filter::BiQuad ref{filter::LOPASS};
+
+   filter.setFreq(1000.0);
+   ref.setFreq(1000.0);
+
+   Signal block[32];
+
+   for(unsigned b = 0; b < 4; ++b)
+   {
+      for(unsigned i = 0; i < 32; ++i)
+         block[i] = (i & 8) ? +1.0 : -1.0;
+
+      filter.process(block, block, 32);
+
+      for(unsigned i = 0; i < 32; ++i)
+      {
+         EXPECT_EQ(ref((i & 8) ? +1.0 : -1.0), block[i]);
+      }
+   }
+}
+
+TEST(SIG_filter, dual_biquad_block)
+{
+   filter::DualBiQuad filter{filter::HIPASS};
+   filter::DualBiQuad ref{filter::HIPASS};
+
+   filter.setFreq(500.0);
+   ref.setFreq(500.0);
+
+   Signal in[64];
+   Signal out[64];
+
+   for(unsigned i = 0; i < 64; ++i)
+      in[i] = (i & 4) ? +0.5 : -0.5;
+
+   filter.process(in, out, 64);
+
+   for(unsigned i = 0; i < 64; ++i)
+   {
+      EXPECT_EQ(ref(in[i]), out[i]);
+   }
+}
+
+TEST(SIG_filter, cascade_matches_chain)
+{
+   filter::BiQuadCascade<2> cascade;
+   filter::BiQuad           ref1{filter::LOPASS};
+   filter::BiQuad           ref2{filter::HIPASS};
+
+   cascade.setStage(0, filter::LOPASS, 2000.0);
+   cascade.setStage(1, filter::HIPASS, 200.0);
+   cascade.update();
+
+   ref1.setFreq(2000.0);
+   ref2.setFreq(200.0);
+
+   Signal block[64];
+
+   for(unsigned b = 0; b < 4; ++b)
+   {
+      for(unsigned i = 0; i < 64; ++i)
+         block[i] = (i & 16) ? +1.0 : -1.0;
+
+      cascade.process(block, block, 64);
+
+      for(unsigned i = 0; i < 64; ++i)
+      {
+         EXPECT_NEAR(ref2(ref1((i & 16) ? +1.0 : -1.0)), block[i], 1e-4);
+      }
+   }
+}
+
+TEST(SIG_filter, cascade_lanes)
+{
+   filter::BiQuadCascade<1, 4> cascade;
+   filter::BiQuad              ref[4];
+
+   const filter::Type type[4] = {filter::LOPASS, filter::HIPASS, filter::LOPASS, filter::BYPASS};
+   const Freq         freq[4] = {500.0, 1000.0, 4000.0, 100.0};
+
+   for(unsigned lane = 0; lane < 4; ++lane)
+   {
+      cascade.setStage(0, lane, type[lane], freq[lane]);
+      ref[lane].setType(type[lane]);
+      ref[lane].setFreq(freq[lane]);
+   }
+
+   cascade.update();
+
+   Signal in[4 * 32];
+   Signal out[4 * 32];
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      for(unsigned lane = 0; lane < 4; ++lane)
+         in[i * 4 + lane] = ((i + lane) & 4) ? +0.5 : -0.5;
+   }
+
+   cascade.process(in, out, 32);
+
+   for(unsigned i = 0; i < 32; ++i)
+   {
+      for(unsigned lane = 0; lane < 4; ++lane)
+      {
+         EXPECT_NEAR(ref[lane](in[i * 4 + lane]), out[i * 4 + lane], 1e-4);
+      }
+   }
+}
+
+TEST(SIG_filter, cascade_update)
+{
+   filter::BiQuadCascade<1> cascade;
+
+   // Default sections pass the signal through unchanged
+   cascade.setStage(0, filter::OFF, 1000.0);
+
+   Signal x = 0.75;
+   cascade(&x, &x);
+   EXPECT_EQ(0.75, x);
+
+   // Until update() is called
+   cascade.update();
+
+   x = 0.75;
+   cascade(&x, &x);
+   EXPECT_EQ(0.0, x);
+}
+
+TEST(SIG_filter, cascade_update_in_use)
+{
+   filter::BiQuadCascade<1> cascade;
+
+   cascade.setStage(0, filter::OFF, 1000.0);
+   EXPECT_TRUE(cascade.update());
+
+   // The audio side may still hold the other set
+   cascade.setStage(0, filter::BYPASS, 1000.0);
+   EXPECT_FALSE(cascade.update());
+
+   Signal x = 0.75;
+   cascade(&x, &x);
+   EXPECT_EQ(0.0, x);
+
+   // Kept until it can be published
+   EXPECT_TRUE(cascade.update());
+
+   x = 0.75;
+   cascade(&x, &x);
+   EXPECT_EQ(0.75, x);
+}
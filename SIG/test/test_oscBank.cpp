@@ -0,0 +1,97 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/osc/Bank.h"
+#include "SIG/osc/Ramp.h"
+#include "SIG/osc/Sine.h"
+#include "SIG/osc/Square.h"
+#include "SIG/osc/Triangle.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+template <typename OSC, unsigned N>
+static void checkBank(typename osc::Bank<N>::Wave wave_, double error_)
+{
+   osc::Bank<N> bank{};
+   OSC          ref[N];
+
+   bank.setWave(wave_);
+
+   for(unsigned v = 0; v < N; ++v)
+   {
+      bank.setNote(v, 30 + v * 5);
+      bank.setGain(v, Signal(1.0) / N);
+
+      ref[v].setNote(30 + v * 5);
+      ref[v].gain = Signal(1.0) / N;
+   }
+
+   Signal block[100];
+
+   for(unsigned b = 0; b < 4; ++b)
+   {
+      bank.process(block, 100);
+
+      for(unsigned i = 0; i < 100; ++i)
+      {
+         Signal sum{};
+
+         for(unsigned v = 0; v < N; ++v)
+            sum += ref[v]();
+
+         EXPECT_NEAR(sum, block[i], error_);
+      }
+   }
+
+   for(unsigned v = 0; v < N; ++v)
+   {
+      EXPECT_EQ(ref[v].getPhase(), bank.getPhase(v));
+   }
+}
+
+TEST(SIG_osc, bank_sine)
+{
+   checkBank<osc::Sine, 5>(osc::Bank<5>::SINE, 0.0001);
+}
+
+TEST(SIG_osc, bank_triangle)
+{
+   checkBank<osc::Triangle, 7>(osc::Bank<7>::TRIANGLE, 0.0001);
+}
+
+TEST(SIG_osc, bank_ramp)
+{
+   checkBank<osc::Ramp, 9>(osc::Bank<9>::RAMP, 0.001);
+}
+
+TEST(SIG_osc, bank_square)
+{
+   checkBank<osc::Square, 16>(osc::Bank<16>::SQUARE, 0.001);
+}
+
+TEST(SIG_osc, bank_mute)
+{
+   osc::Bank<3> bank{};
+
+   bank.setWave(osc::Bank<3>::SQUARE);
+
+   for(unsigned v = 0; v < bank.size(); ++v)
+   {
+      bank.setFreq(v, 440.0);
+      bank.setGain(v, 1.0);
+      bank.mute(v);
+   }
+
+   Signal block[8];
+
+   bank.process(block, 8);
+
+   for(unsigned i = 0; i < 8; ++i)
+   {
+      EXPECT_NEAR(3.0, block[i], 0.0001);
+   }
+}
@@ -53,3 +53,26 @@ TEST(SIG_osc, square)
       }
    }
 }
+
+TEST(SIG_osc, square_block)
+{
+   osc::Square osc{};
+   osc::Square ref{};
+
+   osc.setFreq(440.0);
+   ref.setFreq(440.0);
+
+   Signal block[64];
+
+   for(unsigned b = 0; b < 4; ++b)
+   {
+      osc.process(block, 64);
+
+      for(unsigned i = 0; i < 64; ++i)
+      {
+         EXPECT_EQ(ref(), block[i]);
+      }
+   }
+
+   EXPECT_EQ(ref.getPhase(), osc.getPhase());
+}
@@ -0,0 +1,211 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include "SIG/osc/Additive.h"
+
+#include "STB/Test.h"
+
+using namespace SIG;
+
+//! Worst error against a sine over one period at a low note
+static double sineError(osc::Interp interp_)
+{
+   osc::Additive<1, 8> osc{};
+
+   osc.a[1] = 1.0;
+   EXPECT_TRUE(osc.computeWave());
+   osc.setInterp(interp_);
+   osc.setFreq(100.0);
+
+   double worst = 0.0;
+
+   for(unsigned i = 0; i < SAMPLE_RATE / 100; ++i)
+   {
+      double expect = sin(uphase2float(osc.getPhase()) * 2 * M_PI);
+      double error  = fabs(expect - osc());
+
+      if (error > worst) worst = error;
+   }
+
+   return worst;
+}
+
+TEST(SIG_osc, wavetable_interp)
+{
+   double none   = sineError(osc::Interp::NONE);
+   double linear = sineError(osc::Interp::LINEAR);
+   double cubic  = sineError(osc::Interp::CUBIC);
+
+   EXPECT_GT(0.03,    none);
+   EXPECT_GT(0.0002,  linear);
+   EXPECT_GT(0.00002, cubic);
+   EXPECT_GT(none,    linear);
+   EXPECT_GT(linear,  cubic);
+}
+
+TEST(SIG_osc, wavetable_block)
+{
+   osc::Additive<4, 8> osc{};
+   osc::Additive<4, 8> ref{};
+
+   for(auto* o : {&osc, &ref})
+   {
+      o->a[1] = 1.0;
+      o->a[3] = 0.3;
+      EXPECT_TRUE(o->computeWave());
+      o->setInterp(osc::Interp::CUBIC);
+      o->setNote(60);
+   }
+
+   Signal block[50];
+
+   osc.process(block, 50);
+
+   for(unsigned i = 0; i < 50; ++i)
+   {
+      EXPECT_EQ(ref(), block[i]);
+   }
+}
+
+TEST(SIG_osc, wavetable_mipmap)
+{
+   // Fundamental and an even 20th harmonic, only the 20th harmonic
+   // survives a half cycle shift
+   osc::Additive<20, 8, 4> osc{};
+
+   osc.a[1]  = 1.0;
+   osc.a[20] = 0.5;
+   EXPECT_TRUE(osc.computeWave());
+
+   const unsigned SHIFT = 32 - 8;
+
+   double low_sum  = 0.0;
+   double high_sum = 0.0;
+
+   for(unsigned i = 0; i < 256; ++i)
+   {
+      UPhase phase = i << SHIFT;
+
+      // Level 0, less than one table step per sample
+      osc.setDelta(1 << (SHIFT - 1));
+      osc.setPhase(phase);
+      Signal v1 = osc();
+      osc.setPhase(phase + UPHASE_HALF);
+      Signal v2 = osc();
+      low_sum += fabs(v1 + v2);
+
+      // Level 3, only 16 harmonics
+      osc.setDelta(4 << SHIFT);
+      osc.setPhase(phase);
+      v1 = osc();
+      osc.setPhase(phase + UPHASE_HALF);
+      v2 = osc();
+      high_sum += fabs(v1 + v2);
+   }
+
+   EXPECT_LT(50.0, low_sum);
+   EXPECT_GT(0.01, high_sum);
+}
+
+//! Direct evaluation of the harmonic series used by the test below
+static Signal harmonicSum(const osc::Additive<12, 8>& osc_, Float t_)
+{
+   Signal value = osc_.a[0] / 2.0;
+
+   for(unsigned n = 1; n <= 12; ++n)
+   {
+      value += osc_.a[n] * sin(n * t_ * 2 * M_PI);
+      value += osc_.b[n] * cos(n * t_ * 2 * M_PI);
+   }
+
+   return value;
+}
+
+TEST(SIG_osc, additive_fft_matches_direct)
+{
+   osc::Additive<12, 8> osc{};
+
+   for(unsigned n = 0; n <= 12; ++n)
+   {
+      osc.a[n] = Float(1.0) / (n + 1);
+      osc.b[n] = (n & 1) ? Float(0.25) : Float(0.0);
+   }
+
+   EXPECT_TRUE(osc.computeWave());
+
+   Signal min{+1.0};
+   Signal max{-1.0};
+
+   for(unsigned i = 0; i < 256; ++i)
+   {
+      Signal value = harmonicSum(osc, Float(i) / 256);
+      if (value > max) max = value;
+      if (value < min) min = value;
+   }
+
+   size_t        size;
+   const Signal* table = osc.getTable(size);
+
+   EXPECT_EQ(256u, size);
+
+   for(unsigned i = 0; i < 256; ++i)
+   {
+      Signal expect = 2.0 * (harmonicSum(osc, Float(i) / 256) - min) / (max - min) - 1.0;
+
+      EXPECT_NEAR(expect, table[i], 0.0001);
+   }
+}
+
+TEST(SIG_osc, wavetable_rebuild_in_use)
+{
+   osc::Additive<1, 8> osc{};
+
+   osc.a[1] = 1.0;
+   EXPECT_TRUE(osc.computeWave());
+
+   Signal block[16];
+   osc.process(block, 16);
+
+   EXPECT_TRUE(osc.computeWave());
+
+   // The render side may still be reading the other buffer
+   EXPECT_FALSE(osc.computeWave());
+
+   osc.process(block, 16);
+
+   EXPECT_TRUE(osc.computeWave());
+}
+
+TEST(SIG_osc, wavetable_rebuild_before_render)
+{
+   osc::Additive<2, 8> osc{};
+
+   osc.a[1] = 1.0;
+   EXPECT_TRUE(osc.computeWave());
+
+   // Nothing has been rendered so the second set of harmonics is taken
+   osc.a[1] = 0.0;
+   osc.a[2] = 1.0;
+   EXPECT_TRUE(osc.computeWave());
+
+   size_t        size;
+   const Signal* table = osc.getTable(size);
+
+   for(unsigned i = 0; i < size; ++i)
+   {
+      EXPECT_NEAR(sin(4 * M_PI * i / size), table[i], 0.0001);
+   }
+
+   // And is what is rendered
+   osc.setInterp(osc::Interp::CUBIC);
+   osc.setFreq(100.0);
+
+   for(unsigned i = 0; i < 64; ++i)
+   {
+      double expect = sin(uphase2float(osc.getPhase()) * 4 * M_PI);
+
+      EXPECT_NEAR(expect, osc(), 0.001);
+   }
+}
@@ -7,8 +7,8 @@
 //
 // NOTE some comments and code snippets have been derived from the RFC
 
-#include <cassert>
 #include <cstdint>
+#include <cstring>
 
 #include <array>
 #include <vector>
@@ -16,63 +16,91 @@
 #include "STB/Deflate.h"
 
 
-class DeflateImpl
+namespace STB {
+
+class Deflate::Impl
 {
 public:
-   DeflateImpl(STB::Deflate::Io* io_, size_t log2_window_size_)
+   Impl(Deflate::Io* io_, size_t log2_window_size_)
       : io(io_)
    {
-       size_t window_size = 1 << log2_window_size_;
+       // The window also buffers output not yet passed on, so must be
+       // able to hold at least one maximum length match
+       size_t window_size = size_t(1) << log2_window_size_;
+
+       if (window_size < MIN_WINDOW)
+       {
+          window_size = MIN_WINDOW;
+       }
 
        window_mask = window_size - 1;
 
        window.resize(window_size);
    }
 
-   //! Inflate a DEFLATE stream \return number of bytes in the output stream
+   //! Inflate a DEFLATE stream to Io::write() \return number of bytes in the output stream
    size_t inflate()
    {
-      bytes_out = 0;
+      while(decode())
+      {
+         flush();
+      }
+
+      flush();
+
+      return state == FAILED ? 0 : bytes_out;
+   }
 
-      bool quit = false;
+   //! Inflate the next part of a DEFLATE stream \return number of bytes written
+   size_t inflate(uint8_t* out, size_t size)
+   {
+      size_t n = 0;
 
-      while(!quit)
+      while(true)
       {
-         // Read block header
-         quit           = getBits(1);
-         unsigned btype = getBits(2);
+         n += deliver(out + n, size - n);
 
-         if (btype == 0b00)
+         if ((n == size) || !decode())
          {
-            skipToNextByte();
+            return n + deliver(out + n, size - n);
+         }
+      }
+   }
 
-            uint16_t len  = uint16_t(getBits(16));
-            uint16_t nlen = uint16_t(getBits(16));
+   //! Read input following the end of the stream
+   size_t readTail(uint8_t* data, size_t size)
+   {
+      size_t n = 0;
 
-            if (nlen != uint16_t(~len))
-            {
-               io->error("DEFLATE LEN != ~NLEN");
-               return 0;
-            }
+      // Whole bytes still in the bit buffer
+      for(; (n < size) && (buffer_bits >= 8); n++)
+      {
+         data[n] = uint8_t(bit_buffer);
+         dropBits(8);
+      }
 
-            copyBlock(len);
-         }
-         else
-         {
-            switch(btype)
-            {
-            case 0b01: buildFixedHuffmanTrees();   break;
-            case 0b10: buildDynamicHuffmanTrees(); break;
-            default:   io->error("DEFLATE bad block type"); return 0;
-            }
+      if (n == size) return n;
 
-            inflateBlock();
-         }
-      }
+      // Then read-ahead still in the input buffer
+      bit_buffer  = 0;
+      buffer_bits = 0;
+
+      size_t avail = in_end - in_pos;
+      size_t len   = avail < (size - n) ? avail : size - n;
 
-      skipToNextByte();
+      memcpy(data + n, in_pos, len);
+      in_pos += len;
+      n      += len;
 
-      return bytes_out;
+      // Then the I/O
+      while(n < size)
+      {
+         size_t len = io->read(data + n, size - n);
+         if (len == 0) break;
+         n += len;
+      }
+
+      return n;
    }
 
 private:
@@ -81,10 +109,14 @@ private:
    static const unsigned LIT_LEN_CODES    = 288;
    static const unsigned CODE_LEN_CODES   =  19;
    static const unsigned END_OF_BLOCK_LIT = 256;
+   static const unsigned MAX_MATCH        = 258;
+   static const size_t   MIN_WINDOW       = 512;
+
+   //! Bits resolved by the first level of table look-up
+   static const unsigned PRIMARY_BITS = 9;
+   static const unsigned PRIMARY_MASK = (1 << PRIMARY_BITS) - 1;
 
-   static const size_t   MAX_HUFF_NODES = DISTANCE_CODES * 2 - 1 +
-                                          LIT_LEN_CODES  * 2 - 1 +
-                                          CODE_LEN_CODES * 2 - 1;
+   static const uint16_t BAD_SYMBOL = 0xFFFF;
 
    struct HuffCode
    {
@@ -92,37 +124,27 @@ private:
       uint16_t value;
    };
 
-   struct HuffNode
+   //! Huffman decode table entry
+   //
+   //! When sub_bits is zero the entry decodes symbol "value" from a code of
+   //! "len" bits. Otherwise the code is longer than PRIMARY_BITS and "value"
+   //! is the index of a secondary table indexed by the next sub_bits bits
+   struct HuffEntry
    {
-      HuffNode* branch[2] = {};
-      int       symbol{0};
+      uint16_t value{BAD_SYMBOL};
+      uint8_t  len{MAX_BITS + 1};
+      uint8_t  sub_bits{0};
    };
 
+   //! Primary table of (1 << PRIMARY_BITS) entries then secondary tables
+   using HuffTable = std::vector<HuffEntry>;
+
    struct ExtraBits
    {
       unsigned bits;
       unsigned base;
    };
 
-   void resetNodeAlloc()
-   {
-      node_list.resize(MAX_HUFF_NODES);
-      next_free_node = 0;
-   }
-
-   HuffNode* allocNode()
-   {
-      assert(next_free_node < node_list.size());
-
-      HuffNode* node = &node_list[next_free_node++];
-
-      node->branch[0] = nullptr;
-      node->branch[1] = nullptr;
-      node->symbol    = 0;
-
-      return node;
-   }
-
    //! Compute ascending sequence of Huffman codes from bit length data
    static void huffBitLengthToCodes(HuffCode* table, unsigned num_codes)
    {
@@ -134,6 +156,7 @@ private:
       }
 
       // Find the numerical value of the smallest code for each bit length
+      bl_count[0] = 0;
       std::array<unsigned,MAX_BITS+1> next_code;
       unsigned code = 0;
       for(unsigned bits = 1; bits <= MAX_BITS; bits++)
@@ -153,45 +176,98 @@ private:
       }
    }
 
-   //! Build a binary tree to decode a huffman encoded stream
-   HuffNode* buildHuffmanTree(HuffCode* table, unsigned num_codes)
+   //! Reverse the order of the least significant bits of a code
+   static unsigned reverseBits(unsigned code, unsigned len)
    {
-      huffBitLengthToCodes(table, num_codes);
+      unsigned rev = 0;
 
-      HuffNode* root = allocNode();
+      for(unsigned bit = 0; bit < len; bit++)
+      {
+         rev  = (rev << 1) | (code & 1);
+         code >>= 1;
+      }
+
+      return rev;
+   }
 
+   //! Build a look-up table to decode a huffman encoded stream
+   //
+   //! Codes arrive most significant bit first, so each table is indexed by
+   //! the bit reversed code and an entry for a short code is repeated for
+   //! every value of the unused index bits
+   static void buildHuffmanTable(HuffTable& table, HuffCode* code, unsigned num_codes)
+   {
+      huffBitLengthToCodes(code, num_codes);
+
+      table.assign(1 << PRIMARY_BITS, HuffEntry{});
+
+      // Size a secondary table for each primary index shared by long codes
       for(unsigned i = 0; i < num_codes; i++)
       {
-         if (table[i].len != 0)
+         unsigned len = code[i].len;
+
+         if (len > PRIMARY_BITS)
          {
-            uint16_t value = table[i].value;
-            HuffNode* node = root;
+            unsigned   rev      = reverseBits(code[i].value, len);
+            HuffEntry& primary  = table[rev & PRIMARY_MASK];
+            unsigned   sub_bits = len - PRIMARY_BITS;
 
-            for(signed bit = table[i].len - 1; bit >= 0; bit--)
+            if (sub_bits > primary.sub_bits)
             {
-               unsigned digit = (value >> bit) & 1;
+               primary.sub_bits = sub_bits;
+               primary.len      = PRIMARY_BITS;
+            }
+         }
+      }
 
-               if (node->branch[digit] == nullptr)
-               {
-                  node->branch[0] = allocNode();
-                  node->branch[1] = allocNode();
-                  node->symbol    = -1;
-               }
+      for(unsigned index = 0; index <= PRIMARY_MASK; index++)
+      {
+         HuffEntry& primary = table[index];
+
+         if (primary.sub_bits != 0)
+         {
+            primary.value = table.size();
+            table.resize(table.size() + (1 << primary.sub_bits));
+         }
+      }
+
+      // Fill in the symbols
+      for(unsigned i = 0; i < num_codes; i++)
+      {
+         unsigned len = code[i].len;
 
-               node = node->branch[digit];
+         if (len == 0) continue;
+
+         unsigned  rev = reverseBits(code[i].value, len);
+         HuffEntry entry;
+
+         entry.value = i;
+         entry.len   = len;
+
+         if (len <= PRIMARY_BITS)
+         {
+            for(unsigned index = rev; index <= PRIMARY_MASK; index += 1 << len)
+            {
+               table[index] = entry;
             }
+         }
+         else
+         {
+            const HuffEntry& primary = table[rev & PRIMARY_MASK];
+            unsigned         size    = 1 << primary.sub_bits;
 
-            node->symbol = i;
+            for(unsigned index = rev >> PRIMARY_BITS; index < size; index += 1 << (len - PRIMARY_BITS))
+            {
+               table[primary.value + index] = entry;
+            }
          }
       }
-
-      return root;
    }
 
-   //! Build Huffman trees with a static configuration
-   void buildFixedHuffmanTrees()
+   //! Build Huffman tables with a static configuration
+   void buildFixedHuffmanTables()
    {
-      resetNodeAlloc();
+      if (fixed_tables) return;
 
       HuffCode code[LIT_LEN_CODES];
 
@@ -200,17 +276,19 @@ private:
       for(unsigned i = 256; i <= 279; i++) { code[i].len = 7; }
       for(unsigned i = 280; i <= 287; i++) { code[i].len = 8; }
 
-      lit_len_tree = buildHuffmanTree(code, LIT_LEN_CODES);
+      buildHuffmanTable(lit_len_table, code, LIT_LEN_CODES);
 
       for(unsigned i = 0; i < DISTANCE_CODES; i++ ) { code[i].len = 5; }
 
-      dist_tree = buildHuffmanTree(code, DISTANCE_CODES);
+      buildHuffmanTable(dist_table, code, DISTANCE_CODES);
+
+      fixed_tables = true;
    }
 
-   //! Build Huffman trees with a dynamic configuration from the stream
-   void buildDynamicHuffmanTrees()
+   //! Build Huffman tables with a dynamic configuration from the stream
+   bool buildDynamicHuffmanTables()
    {
-      resetNodeAlloc();
+      fixed_tables = false;
 
       static unsigned code_length_order[CODE_LEN_CODES] =
       {
@@ -222,7 +300,7 @@ private:
       unsigned hdist = getBits(5) + 1;
       unsigned hclen = getBits(4) + 4;
 
-      HuffCode code[LIT_LEN_CODES];
+      HuffCode code[LIT_LEN_CODES + DISTANCE_CODES];
       unsigned i;
 
       // Read code length table
@@ -235,96 +313,247 @@ private:
          code[code_length_order[i]].len = 0;
       }
 
-      HuffNode* code_len_tree = buildHuffmanTree(code, CODE_LEN_CODES);
+      buildHuffmanTable(code_len_table, code, CODE_LEN_CODES);
 
-      unsigned repeat;
+      // Literal/length and distance code lengths form one sequence and a
+      // repeat may run from one into the other
       unsigned prev_code_len = 0;
-      unsigned code_len;
 
-      // Read literal/length code length table
-      for(i = 0; i < hlit;)
+      for(i = 0; i < hlit + hdist;)
       {
-         code_len = decodeCodeLen(code_len_tree, prev_code_len, repeat);
+         unsigned repeat;
+         unsigned code_len = decodeCodeLen(prev_code_len, repeat);
+
+         if ((code_len > MAX_BITS) || (i + repeat > hlit + hdist))
+         {
+            fail("DEFLATE bad code lengths");
+            return false;
+         }
+
          while(repeat-- > 0)
          {
             code[i++].len = code_len;
          }
       }
-      for(; i < LIT_LEN_CODES; i++)
+
+      HuffCode dist_code[DISTANCE_CODES];
+
+      for(i = 0; i < DISTANCE_CODES; i++)
+      {
+         dist_code[i].len = i < hdist ? code[hlit + i].len : 0;
+      }
+
+      for(i = hlit; i < LIT_LEN_CODES; i++)
       {
          code[i].len = 0;
       }
 
-      lit_len_tree = buildHuffmanTree(code, LIT_LEN_CODES);
+      buildHuffmanTable(lit_len_table, code, LIT_LEN_CODES);
+      buildHuffmanTable(dist_table, dist_code, DISTANCE_CODES);
+
+      return true;
+   }
 
-      // Read distance code length table
-      for(i = 0; i < hdist;)
+   //! Top up the bit buffer from the input buffer, no I/O
+   void refill()
+   {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      if ((in_end - in_pos) >= 8)
       {
-         code_len = decodeCodeLen(code_len_tree, prev_code_len, repeat);
-         while(repeat-- > 0)
-         {
-            code[i++].len = code_len;
-         }
+         // Load a whole word and keep as many bytes as fit
+         uint64_t word;
+         memcpy(&word, in_pos, sizeof(word));
+
+         bit_buffer  |= word << buffer_bits;
+         in_pos      += (63 - buffer_bits) >> 3;
+         buffer_bits |= 56;
+         return;
       }
-      for(; i < DISTANCE_CODES; i++)
+#endif
+
+      while((buffer_bits <= 56) && (in_pos != in_end))
       {
-         code[i].len = 0;
+         bit_buffer  |= uint64_t(*in_pos++) << buffer_bits;
+         buffer_bits += 8;
+      }
+   }
+
+   //! Read more input into the input buffer \return false at end of input
+   bool readInput()
+   {
+      size_t len = io->read(in_buffer, sizeof(in_buffer));
+
+      in_pos = in_buffer;
+      in_end = in_buffer + len;
+
+      if (len == 0)
+      {
+         // Treat as zeros, the error state will end decoding
+         fail("DEFLATE unexpected end of input");
+         return false;
+      }
+
+      return true;
+   }
+
+   //! Append more input to the bit buffer
+   void fetch()
+   {
+      if ((in_pos == in_end) && !readInput())
+      {
+         buffer_bits += 8;
+         return;
       }
 
-      dist_tree = buildHuffmanTree(code, DISTANCE_CODES);
+      refill();
+   }
+
+   //! Make sure at least N bits are in the bit buffer
+   //
+   //! The I/O is only read when the input buffer has been used up
+   void needBits(unsigned num_bits)
+   {
+      while(buffer_bits < num_bits)
+      {
+         fetch();
+      }
+   }
+
+   //! Discard N bits from the bit buffer
+   void dropBits(unsigned num_bits)
+   {
+      bit_buffer  >>= num_bits;
+      buffer_bits -= num_bits;
    }
 
    //! Return the next N bits from the input stream
    uint32_t getBits(unsigned num_bits)
    {
-      uint32_t value = 0;
+      needBits(num_bits);
+
+      uint32_t value = uint32_t(bit_buffer) & ((uint32_t(1) << num_bits) - 1);
+
+      dropBits(num_bits);
+
+      return value;
+   }
+
+   //! Ignore remaining bits in last byte read from the input stream
+   void skipToNextByte()
+   {
+      dropBits(buffer_bits & 7);
+   }
+
+   //! Decode the next symbol \return BAD_SYMBOL for an unassigned code
+   unsigned getSymbol(const HuffTable& table)
+   {
+      if (buffer_bits < MAX_BITS)
+      {
+         refill();
+      }
 
-      for(unsigned bit = 0; bit < num_bits; bit++)
+      while(true)
       {
-         if (buffer_bits == 0)
+         // Bits not yet in the buffer read as zero, the entry is only
+         // trusted once its code length is covered by real bits
+         const HuffEntry* entry = &table[bit_buffer & PRIMARY_MASK];
+
+         if (entry->sub_bits != 0)
          {
-            buffer      = io->getByte();
-            buffer_bits = 8;
+            unsigned index = (bit_buffer >> PRIMARY_BITS) & ((1 << entry->sub_bits) - 1);
+
+            entry = &table[entry->value + index];
          }
 
-         value |= (buffer & 1) << bit;
+         if (entry->len <= buffer_bits)
+         {
+            dropBits(entry->len);
+            return entry->value;
+         }
 
-         buffer >>= 1;
-         buffer_bits--;
+         fetch();
       }
+   }
 
-      return value;
+   void fail(const char* message)
+   {
+      if (state != FAILED)
+      {
+         io->error(message);
+         state = FAILED;
+      }
    }
 
-   //! Ignore remaining bits in last byte read from the input stream
-   void skipToNextByte()
+   //! Number of bytes of output held in the window and not yet passed on
+   size_t pending() const { return bytes_out - flushed; }
+
+   //! Number of bytes of output that can be added to the window
+   size_t space() const { return window.size() - pending(); }
+
+   //! Pass output that is still held in the window on to the I/O
+   void flush()
+   {
+      while(pending() != 0)
+      {
+         size_t   offset = flushed & window_mask;
+         size_t   len    = window.size() - offset;
+         if (len > pending()) len = pending();
+
+         io->write(&window[offset], len);
+         flushed += len;
+      }
+   }
+
+   //! Copy output that is still held in the window to a buffer
+   size_t deliver(uint8_t* out, size_t size)
    {
-      if (buffer_bits != 8)
+      size_t n = 0;
+
+      while((pending() != 0) && (n < size))
       {
-         buffer      = 0;
-         buffer_bits = 0;
+         size_t offset = flushed & window_mask;
+         size_t len    = window.size() - offset;
+         if (len > pending()) len = pending();
+         if (len > (size - n)) len = size - n;
+
+         memcpy(out + n, &window[offset], len);
+         flushed += len;
+         n       += len;
       }
+
+      return n;
    }
 
    void putByte(uint8_t byte)
    {
       window[bytes_out++ & window_mask] = byte;
-      io->putByte(byte);
    }
 
-   int getSymbol(HuffNode* tree)
+   //! Copy a previous sequence of output
+   void copyMatch(unsigned dist, unsigned len)
    {
-      HuffNode* node = tree;
+      size_t   size = window.size();
+      unsigned src  = (bytes_out - dist) & window_mask;
+      unsigned dst  = bytes_out & window_mask;
 
-      while(node->symbol == -1)
+      if ((dist >= len) && ((src + len) <= size) && ((dst + len) <= size))
+      {
+         // No overlap and no wrap around the end of the window
+         memcpy(&window[dst], &window[src], len);
+      }
+      else
       {
-         node = node->branch[getBits(1)];
+         // Overlapping copies repeat the most recent output
+         for(unsigned i = 0; i < len; i++)
+         {
+            window[(dst + i) & window_mask] = window[(src + i) & window_mask];
+         }
       }
 
-      return node->symbol;
+      bytes_out += len;
    }
 
-   //! Decode distance value from DEFLATE stream
+   //! Decode distance value from DEFLATE stream \return 0 for a bad code
    unsigned decodeDist()
    {
       static ExtraBits extra[30] =
@@ -337,7 +566,13 @@ private:
          {11, 6145}, {12, 8193}, {12, 12289}, {13, 16385}, {13, 24577}
       };
 
-      unsigned index      = getSymbol(dist_tree);
+      unsigned index = getSymbol(dist_table);
+
+      if (index >= 30)
+      {
+         return 0;
+      }
+
       unsigned extra_bits = extra[index].bits;
       unsigned dist       = extra[index].base;
 
@@ -362,12 +597,17 @@ private:
          {5, 163}, {5, 195}, {5, 227}, {0, 258}
       };
 
-      int lit_len = getSymbol(lit_len_tree);
+      int lit_len = getSymbol(lit_len_table);
 
       if (lit_len > signed(END_OF_BLOCK_LIT))
       {
          lit_len -= END_OF_BLOCK_LIT + 1;
 
+         if (lit_len >= 29)
+         {
+            return BAD_SYMBOL;
+         }
+
          unsigned extra_bits = extra[lit_len].bits;
          lit_len             = extra[lit_len].base;
 
@@ -383,9 +623,9 @@ private:
    }
 
    //! Decode code bit length value from DEFLATE stream
-   unsigned decodeCodeLen(HuffNode* tree, unsigned& prev_code_len, unsigned& repeat)
+   unsigned decodeCodeLen(unsigned& prev_code_len, unsigned& repeat)
    {
-      unsigned code_len = getSymbol(tree);
+      unsigned code_len = getSymbol(code_len_table);
 
       switch(code_len)
       {
@@ -414,68 +654,239 @@ private:
       return code_len;
    }
 
-   //! Copy a block of data
-   void copyBlock(unsigned length)
+   //! Start the next block
+   void decodeHeader()
    {
-      for(unsigned i=0; i<length; i++)
+      final_block    = getBits(1);
+      unsigned btype = getBits(2);
+
+      switch(btype)
       {
-         putByte(uint8_t(getBits(8)));
+      case 0b00:
+         {
+            skipToNextByte();
+
+            uint16_t len  = uint16_t(getBits(16));
+            uint16_t nlen = uint16_t(getBits(16));
+
+            if (nlen != uint16_t(~len))
+            {
+               fail("DEFLATE LEN != ~NLEN");
+               return;
+            }
+
+            stored_len = len;
+            state      = STORED;
+         }
+         break;
+
+      case 0b01:
+         buildFixedHuffmanTables();
+         state = HUFFMAN;
+         break;
+
+      case 0b10:
+         if (buildDynamicHuffmanTables())
+         {
+            state = HUFFMAN;
+         }
+         break;
+
+      default:
+         fail("DEFLATE bad block type");
+         break;
       }
    }
 
-   //! Inflate a DEFLATE block of data via LZ77 decompressor
+   //! Finish the current block
+   void endBlock()
+   {
+      if (final_block)
+      {
+         skipToNextByte();
+         state = END;
+      }
+      else
+      {
+         state = HEADER;
+      }
+   }
+
+   //! Copy some of a stored block of data
+   void copyBlock()
+   {
+      while((stored_len != 0) && (space() != 0))
+      {
+         size_t offset = bytes_out & window_mask;
+         size_t len    = window.size() - offset;
+         if (len > space())    len = space();
+         if (len > stored_len) len = stored_len;
+
+         uint8_t* dst = &window[offset];
+         size_t   n   = 0;
+
+         // Whole bytes already in the bit buffer come first
+         for(; (n < len) && (buffer_bits != 0); n++)
+         {
+            dst[n] = uint8_t(getBits(8));
+         }
+
+         if (buffer_bits == 0)
+         {
+            // Then straight from the input buffer, bits of bytes read ahead
+            // by refill() may still be above buffer_bits and must be dropped
+            bit_buffer = 0;
+         }
+
+         while((n < len) && (buffer_bits == 0) && (state != FAILED))
+         {
+            if ((in_pos == in_end) && !readInput()) break;
+
+            size_t avail = in_end - in_pos;
+            size_t chunk = avail < (len - n) ? avail : len - n;
+
+            memcpy(dst + n, in_pos, chunk);
+            in_pos += chunk;
+            n      += chunk;
+         }
+
+         bytes_out  += n;
+         stored_len -= n;
+
+         if (state == FAILED) return;
+      }
+
+      if (stored_len == 0)
+      {
+         endBlock();
+      }
+   }
+
+   //! Inflate some of a DEFLATE block of data via LZ77 decompressor
    void inflateBlock()
    {
-      while(true)
+      while(space() >= MAX_MATCH)
       {
          signed lit_len = decodeLitLen();
          if (lit_len < 0)
          {
             unsigned dist = decodeDist();
 
-            for(signed len = lit_len; len < 0; len++)
+            if ((dist == 0) || (dist > bytes_out) || (dist > window.size()))
             {
-               putByte(window[(bytes_out - dist) & window_mask]);
+               fail("DEFLATE bad distance");
+               return;
             }
+
+            copyMatch(dist, -lit_len);
          }
          else if (lit_len == signed(END_OF_BLOCK_LIT))
          {
-            break;
+            endBlock();
+            return;
          }
-         else
+         else if (lit_len < signed(END_OF_BLOCK_LIT))
          {
             putByte(uint8_t(lit_len));
          }
+         else
+         {
+            fail("DEFLATE bad literal/length code");
+            return;
+         }
+
+         if (state == FAILED) return;
+      }
+   }
+
+   //! Decode until the window is full or a block ends
+   //
+   //! \return false once the stream has ended or failed
+   bool decode()
+   {
+      switch(state)
+      {
+      case HEADER:  decodeHeader(); break;
+      case STORED:  copyBlock();    break;
+      case HUFFMAN: inflateBlock(); break;
+      case END:     return false;
+      case FAILED:  return false;
       }
+
+      return true;
    }
 
+   enum State { HEADER, STORED, HUFFMAN, END, FAILED };
+
+   static const size_t IN_BUFFER_SIZE = 512;
+
    // I/O state
-   STB::Deflate::Io*     io{nullptr};
-   uint8_t               buffer{0};
+   Deflate::Io*          io{nullptr};
+   uint8_t               in_buffer[IN_BUFFER_SIZE];
+   const uint8_t*        in_pos{in_buffer};
+   const uint8_t*        in_end{in_buffer};
+   uint64_t              bit_buffer{0};
    unsigned              buffer_bits{0};
    size_t                bytes_out{0};
+   size_t                flushed{0};   //!< Output passed on from the window
+
+   // Block state
+   State                 state{HEADER};
+   bool                  final_block{false};
+   size_t                stored_len{0};
 
-   // Compression window
+   // Compression window, also holds output not yet passed on
    std::vector<uint8_t>  window;
    uint32_t              window_mask{0};
 
-   // Huffman tree storage
-   std::vector<HuffNode> node_list;
-   size_t                next_free_node{0};
-
-   // Huffman trees
-   HuffNode*             lit_len_tree{nullptr};
-   HuffNode*             dist_tree{nullptr};
+   // Huffman decode tables
+   HuffTable             code_len_table;
+   HuffTable             lit_len_table;
+   HuffTable             dist_table;
+   bool                  fixed_tables{false};
 };
 
 
-namespace STB {
+Deflate::~Deflate()
+{
+   delete pimpl;
+}
 
 size_t Deflate::inflate(size_t log2_window_size)
 {
-   DeflateImpl impl{io, log2_window_size};
+   delete pimpl;
+   pimpl = new Impl{io, log2_window_size};
 
-   return impl.inflate();
+   return pimpl->inflate();
 }
 
+size_t Deflate::inflate(uint8_t* out_, size_t size_, size_t log2_window_size)
+{
+   if (pimpl == nullptr)
+   {
+      pimpl = new Impl{io, log2_window_size};
+   }
+
+   return pimpl->inflate(out_, size_);
 }
+
+size_t Deflate::readTail(uint8_t* data_, size_t size_)
+{
+   if (pimpl == nullptr)
+   {
+      size_t n = 0;
+
+      while(n < size_)
+      {
+         size_t len = io->read(data_ + n, size_ - n);
+         if (len == 0) break;
+         n += len;
+      }
+
+      return n;
+   }
+
+   return pimpl->readTail(data_, size_);
+}
+
+} // namespace STB
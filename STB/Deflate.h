@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -13,22 +14,103 @@ namespace STB {
 class Deflate
 {
 public:
+   //! Compressed input and decompressed output
+   //
+   //! Implement at least one of getByte()/read() and one of putByte()/write(),
+   //! the defaults for each pair are written in terms of the other. An Io
+   //! that only implements getByte() must also implement atEnd() to deflate()
    class Io
    {
    public:
-      virtual uint8_t getByte()        = 0;
-      virtual void    putByte(uint8_t) = 0;
-      virtual void    error(const std::string&) {}
+      virtual uint8_t getByte()
+      {
+         uint8_t byte{0};
+         (void) read(&byte, 1);
+         return byte;
+      }
+
+      virtual void putByte(uint8_t byte_)
+      {
+         write(&byte_, 1);
+      }
+
+      //! Returns true when getByte() has no more input
+      //
+      //! Only used by the default read(). Inflation stops at the end of the
+      //! compressed stream so only deflate() depends on this
+      virtual bool atEnd() { return false; }
+
+      //! Read up to size_ bytes of input \return number of bytes read, 0 at end of input
+      //
+      //! Only return data that belongs to the compressed stream or may be read
+      //! after it. The default reads a single byte
+      virtual size_t read(uint8_t* data_, size_t)
+      {
+         if (atEnd()) return 0;
+
+         data_[0] = getByte();
+         return 1;
+      }
+
+      //! Write a span of output
+      virtual void write(const uint8_t* data_, size_t size_)
+      {
+         for(size_t i = 0; i < size_; ++i)
+         {
+            putByte(data_[i]);
+         }
+      }
+
+      virtual void error(const std::string&) {}
+   };
+
+   //! Compression level
+   enum Level
+   {
+      STORE,  //!< Stored blocks, no compression
+      FIXED,  //!< LZ77 with the fixed Huffman codes
+      DYNAMIC //!< LZ77 with Huffman codes built for each block
    };
 
    Deflate(Io* io_) : io(io_) {}
 
-   //! Inflate DEFLATE stream
-   size_t inflate(size_t window_size);
+   Deflate(const Deflate&) = delete;
+
+   ~Deflate();
+
+   //! Inflate DEFLATE stream passing all output to Io::write()
+   //
+   //! \return size of the output, 0 on error
+   size_t inflate(size_t log2_window_size);
+
+   //! Inflate the next part of a DEFLATE stream into a buffer
+   //
+   //! Repeated calls resume where the previous call finished. The window
+   //! size is taken from the first call
+   //! \return bytes written, less than size_ only at the end of the stream or on error
+   size_t inflate(uint8_t* out_, size_t size_, size_t log2_window_size = 15);
+
+   //! Compress all input into a DEFLATE stream
+   //
+   //! Input is taken from Io::read() until it returns 0, or from
+   //! Io::getByte() until Io::atEnd(), and the stream is passed to
+   //! Io::write(). The working set is about 11 x the window size,
+   //! so small windows (down to 2^8) can be used on constrained targets
+   //! \return size of the compressed stream
+   size_t deflate(Level level_ = DYNAMIC, size_t log2_window_size = 15);
+
+   //! Read input following the end of the DEFLATE stream
+   //
+   //! Input is read ahead in blocks, so a trailer following the stream
+   //! (e.g. zlib Adler-32) must be read here rather than directly from the Io
+   size_t readTail(uint8_t* data_, size_t size_);
 
 private:
-   Io* io{nullptr};
+   class Impl;
+   class Encoder;
+
+   Io*   io{nullptr};
+   Impl* pimpl{nullptr};
 };
 
 } // namespace STB
-
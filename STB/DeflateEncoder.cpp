@@ -0,0 +1,801 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+// See RFC-1951
+//
+// LZ77 matches are found with hash chains over the previous window of input.
+// Matching is greedy and chains are searched to a fixed depth, so the cost
+// per byte is bounded. The working set is roughly 11 x the window size
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <vector>
+
+#include "STB/Deflate.h"
+
+namespace STB {
+
+class Deflate::Encoder
+{
+public:
+   Encoder(Deflate::Io* io_, Deflate::Level level_, size_t log2_window_size_)
+      : io(io_)
+      , level(level_)
+   {
+      if (log2_window_size_ < MIN_LOG2_WINDOW) log2_window_size_ = MIN_LOG2_WINDOW;
+      if (log2_window_size_ > MAX_LOG2_WINDOW) log2_window_size_ = MAX_LOG2_WINDOW;
+
+      window_size = size_t(1) << log2_window_size_;
+      hash_bits   = log2_window_size_;
+
+      buffer.resize(2 * window_size + MAX_MATCH);
+
+      if (level != STORE)
+      {
+         head.assign(size_t(1) << hash_bits, NIL);
+         prev.assign(window_size, NIL);
+
+         size_t block_symbols = std::clamp(window_size, size_t(1024), size_t(16384));
+         symbols.resize(block_symbols);
+      }
+   }
+
+   //! Compress all input \return size of the compressed stream
+   size_t deflate()
+   {
+      if (level == STORE)
+      {
+         storeAll();
+      }
+      else
+      {
+         compressAll();
+      }
+
+      flushBits();
+
+      return bytes_out;
+   }
+
+private:
+   static constexpr unsigned MIN_LOG2_WINDOW   =   8;
+   static constexpr unsigned MAX_LOG2_WINDOW   =  15;
+   static constexpr unsigned MAX_BITS          =  15;
+   static constexpr unsigned MAX_CODE_LEN_BITS =   7;
+   static constexpr unsigned DISTANCE_CODES    =  30;
+   static constexpr unsigned LIT_LEN_CODES     = 286;
+   static constexpr unsigned CODE_LEN_CODES    =  19;
+   static constexpr unsigned END_OF_BLOCK_LIT  = 256;
+   static constexpr unsigned MIN_MATCH         =   3;
+   static constexpr unsigned MAX_MATCH         = 258;
+   static constexpr unsigned MAX_CHAIN         =  64;
+   static constexpr size_t   MAX_STORED        = 0xFFFF;
+   static constexpr uint32_t NIL               = 0xFFFFFFFF;
+
+   //! Literal (dist == 0) or match
+   struct Symbol
+   {
+      uint16_t lit_len;
+      uint16_t dist;
+   };
+
+   struct HuffCode
+   {
+      uint8_t  len{0};
+      uint16_t code{0}; //!< Bit reversed ready to send LSB first
+   };
+
+   struct ExtraBits
+   {
+      unsigned bits;
+      unsigned base;
+   };
+
+   static const ExtraBits* lenExtra()
+   {
+      static const ExtraBits extra[29] =
+      {
+         {0,   3}, {0,   4}, {0,   5}, {0,   6}, {0,   7},
+         {0,   8}, {0,   9}, {0,  10}, {1,  11}, {1,  13},
+         {1,  15}, {1,  17}, {2,  19}, {2,  23}, {2,  27},
+         {2,  31}, {3,  35}, {3,  43}, {3,  51}, {3,  59},
+         {4,  67}, {4,  83}, {4,  99}, {4, 115}, {5, 131},
+         {5, 163}, {5, 195}, {5, 227}, {0, 258}
+      };
+
+      return extra;
+   }
+
+   static const ExtraBits* distExtra()
+   {
+      static const ExtraBits extra[DISTANCE_CODES] =
+      {
+         { 0,    1}, { 0,    2}, { 0,     3}, { 0,     4}, { 1,     5},
+         { 1,    7}, { 2,    9}, { 2,    13}, { 3,    17}, { 3,    25},
+         { 4,   33}, { 4,   49}, { 5,    65}, { 5,    97}, { 6,   129},
+         { 6,  193}, { 7,  257}, { 7,   385}, { 8,   513}, { 8,   769},
+         { 9, 1025}, { 9, 1537}, {10,  2049}, {10,  3073}, {11,  4097},
+         {11, 6145}, {12, 8193}, {12, 12289}, {13, 16385}, {13, 24577}
+      };
+
+      return extra;
+   }
+
+   //! Length code index (0..28) for a match length
+   static unsigned lenIndex(unsigned len)
+   {
+      const ExtraBits* extra = lenExtra();
+      unsigned         index = 28;
+
+      while(extra[index].base > len) index--;
+
+      return index;
+   }
+
+   //! Distance code index (0..29) for a match distance
+   static unsigned distIndex(unsigned dist)
+   {
+      const ExtraBits* extra = distExtra();
+      unsigned         index = DISTANCE_CODES - 1;
+
+      while(extra[index].base > dist) index--;
+
+      return index;
+   }
+
+   // Input ------------------------------------------------------------------
+
+   //! Read input until the buffer is full or the input ends
+   void fillBuffer()
+   {
+      while(!end_of_input && (buffer_end < buffer.size()))
+      {
+         size_t len = io->read(&buffer[buffer_end], buffer.size() - buffer_end);
+
+         if (len == 0)
+         {
+            end_of_input = true;
+         }
+
+         buffer_end += len;
+      }
+   }
+
+   // Output -----------------------------------------------------------------
+
+   void putBits(uint32_t value, unsigned num_bits)
+   {
+      bit_buffer  |= uint64_t(value) << buffer_bits;
+      buffer_bits += num_bits;
+
+      while(buffer_bits >= 8)
+      {
+         putByte(uint8_t(bit_buffer));
+         bit_buffer  >>= 8;
+         buffer_bits -= 8;
+      }
+   }
+
+   void putCode(const HuffCode& code)
+   {
+      putBits(code.code, code.len);
+   }
+
+   void putByte(uint8_t byte)
+   {
+      out_buffer[out_len++] = byte;
+
+      if (out_len == sizeof(out_buffer))
+      {
+         flushOutput();
+      }
+   }
+
+   void flushOutput()
+   {
+      if (out_len != 0)
+      {
+         io->write(out_buffer, out_len);
+         bytes_out += out_len;
+         out_len    = 0;
+      }
+   }
+
+   //! Pad to a byte boundary and pass on all output
+   void flushBits()
+   {
+      if (buffer_bits != 0)
+      {
+         putBits(0, 8 - buffer_bits);
+      }
+
+      flushOutput();
+   }
+
+   // Stored blocks ----------------------------------------------------------
+
+   void putStoredBlock(const uint8_t* data, size_t len, bool final)
+   {
+      putBits(final ? 1 : 0, 1);
+      putBits(0b00, 2);
+      flushBits();
+
+      putBits(len & 0xFFFF, 16);
+      putBits(~len & 0xFFFF, 16);
+
+      for(size_t i = 0; i < len; i++)
+      {
+         putByte(data[i]);
+      }
+   }
+
+   void storeAll()
+   {
+      while(true)
+      {
+         buffer_end = 0;
+         fillBuffer();
+
+         for(size_t offset = 0; offset < buffer_end; offset += MAX_STORED)
+         {
+            size_t len   = std::min(buffer_end - offset, MAX_STORED);
+            bool   final = end_of_input && (offset + len == buffer_end);
+
+            putStoredBlock(&buffer[offset], len, final);
+         }
+
+         if (end_of_input)
+         {
+            if (buffer_end == 0)
+            {
+               putStoredBlock(nullptr, 0, true);
+            }
+            return;
+         }
+      }
+   }
+
+   // LZ77 -------------------------------------------------------------------
+
+   //! Drop the oldest window of input to make room for more
+   void slideBuffer()
+   {
+      size_t shift = pos - window_size;
+
+      memmove(&buffer[0], &buffer[shift], buffer_end - shift);
+
+      buffer_end -= shift;
+      pos        -= shift;
+      base       += shift;
+   }
+
+   uint32_t hash(size_t index) const
+   {
+      uint32_t value = (buffer[index] << 16) | (buffer[index + 1] << 8) | buffer[index + 2];
+
+      return (value * 0x9E3779B1u) >> (32 - hash_bits);
+   }
+
+   //! Add the string starting at the current position to the hash chains
+   void insertString()
+   {
+      if ((pos + MIN_MATCH) > buffer_end) return;
+
+      uint32_t h   = hash(pos);
+      uint32_t abs = uint32_t(base + pos);
+
+      prev[abs & (window_size - 1)] = head[h];
+      head[h]                       = abs;
+   }
+
+   //! Find the longest match for the current position \return length or 0
+   unsigned findMatch(unsigned& dist)
+   {
+      size_t avail = buffer_end - pos;
+      if (avail < MIN_MATCH) return 0;
+
+      unsigned max_len = avail < MAX_MATCH ? unsigned(avail) : MAX_MATCH;
+      uint32_t abs     = uint32_t(base + pos);
+      uint32_t cand    = head[hash(pos)];
+      unsigned best    = 0;
+
+      const uint8_t* cur = &buffer[pos];
+
+      for(unsigned chain = 0; (chain < MAX_CHAIN) && (cand != NIL); chain++)
+      {
+         if ((cand >= abs) || ((abs - cand) >= window_size) || (cand < base)) break;
+
+         const uint8_t* match = &buffer[cand - base];
+
+         if ((match[best] == cur[best]) && (match[0] == cur[0]))
+         {
+            unsigned len = 0;
+            while((len < max_len) && (match[len] == cur[len])) len++;
+
+            if (len > best)
+            {
+               best = len;
+               dist = abs - cand;
+
+               if (len == max_len) break;
+            }
+         }
+
+         cand = prev[cand & (window_size - 1)];
+      }
+
+      return best >= MIN_MATCH ? best : 0;
+   }
+
+   void compressAll()
+   {
+      fillBuffer();
+
+      while(true)
+      {
+         if (!end_of_input && ((buffer_end - pos) < MAX_MATCH))
+         {
+            slideBuffer();
+            fillBuffer();
+         }
+
+         if (pos == buffer_end)
+         {
+            emitBlock(true);
+            return;
+         }
+
+         unsigned dist;
+         unsigned len = findMatch(dist);
+
+         if (len != 0)
+         {
+            symbols[num_symbols++] = Symbol{uint16_t(len), uint16_t(dist)};
+
+            for(unsigned i = 0; i < len; i++)
+            {
+               insertString();
+               pos++;
+            }
+         }
+         else
+         {
+            symbols[num_symbols++] = Symbol{buffer[pos], 0};
+
+            insertString();
+            pos++;
+         }
+
+         if (num_symbols == symbols.size())
+         {
+            // More input may follow, even if it is all already buffered
+            emitBlock(false);
+         }
+      }
+   }
+
+   // Huffman coding ---------------------------------------------------------
+
+   //! Assign canonical codes to code lengths
+   static void lengthsToCodes(HuffCode* table, unsigned num_codes)
+   {
+      unsigned bl_count[MAX_BITS + 1] = {};
+
+      for(unsigned i = 0; i < num_codes; i++)
+      {
+         bl_count[table[i].len]++;
+      }
+
+      bl_count[0] = 0;
+
+      unsigned next_code[MAX_BITS + 1];
+      unsigned code = 0;
+
+      for(unsigned bits = 1; bits <= MAX_BITS; bits++)
+      {
+         code = (code + bl_count[bits - 1]) << 1;
+         next_code[bits] = code;
+      }
+
+      for(unsigned i = 0; i < num_codes; i++)
+      {
+         unsigned len = table[i].len;
+
+         if (len != 0)
+         {
+            // Reverse so the code can be sent least significant bit first
+            unsigned value = next_code[len]++;
+            unsigned rev   = 0;
+
+            for(unsigned bit = 0; bit < len; bit++)
+            {
+               rev   = (rev << 1) | (value & 1);
+               value >>= 1;
+            }
+
+            table[i].code = rev;
+         }
+      }
+   }
+
+   //! Build Huffman code lengths no longer than max_bits from frequencies
+   static void buildLengths(HuffCode* table, const uint32_t* freq_, unsigned num_codes, unsigned max_bits)
+   {
+      std::vector<uint32_t> freq(freq_, freq_ + num_codes);
+
+      while(true)
+      {
+         // Leaves sorted by frequency then internal nodes in creation order,
+         // both queues stay sorted so merging needs no heap
+         struct Node { uint32_t freq; int parent; };
+
+         std::vector<Node>     node;
+         std::vector<unsigned> leaf;
+
+         for(unsigned i = 0; i < num_codes; i++)
+         {
+            table[i].len = 0;
+
+            if (freq[i] != 0)
+            {
+               leaf.push_back(i);
+            }
+         }
+
+         if (leaf.size() == 1)
+         {
+            table[leaf[0]].len = 1;
+            break;
+         }
+
+         std::stable_sort(leaf.begin(), leaf.end(),
+                          [&](unsigned a, unsigned b) { return freq[a] < freq[b]; });
+
+         for(unsigned symbol : leaf)
+         {
+            node.push_back(Node{freq[symbol], -1});
+         }
+
+         size_t next_leaf = 0;
+         size_t next_int  = leaf.size();
+
+         auto takeSmallest = [&]() -> size_t
+         {
+            if ((next_leaf < leaf.size()) &&
+                ((next_int == node.size()) || (node[next_leaf].freq <= node[next_int].freq)))
+            {
+               return next_leaf++;
+            }
+
+            return next_int++;
+         };
+
+         while((node.size() - next_int) + (leaf.size() - next_leaf) > 1)
+         {
+            size_t a = takeSmallest();
+            size_t b = takeSmallest();
+
+            node.push_back(Node{node[a].freq + node[b].freq, -1});
+
+            node[a].parent = node.size() - 1;
+            node[b].parent = node.size() - 1;
+         }
+
+         // Depth of each leaf
+         std::vector<unsigned> depth(node.size(), 0);
+         unsigned              longest = 0;
+
+         for(size_t i = node.size() - 1; i-- > 0; )
+         {
+            depth[i] = depth[node[i].parent] + 1;
+         }
+
+         for(size_t i = 0; i < leaf.size(); i++)
+         {
+            table[leaf[i]].len = depth[i];
+            longest = std::max(longest, depth[i]);
+         }
+
+         if (longest <= max_bits) break;
+
+         // Flatten the distribution and try again
+         for(auto& f : freq)
+         {
+            if (f != 0) f = (f + 1) / 2;
+         }
+      }
+
+      lengthsToCodes(table, num_codes);
+   }
+
+   //! Fixed Huffman codes (RFC-1951 3.2.6)
+   void fixedCodes()
+   {
+      for(unsigned i =   0; i <= 143; i++) { lit_len_code[i].len = 8; }
+      for(unsigned i = 144; i <= 255; i++) { lit_len_code[i].len = 9; }
+      for(unsigned i = 256; i <= 279; i++) { lit_len_code[i].len = 7; }
+      for(unsigned i = 280; i <  288; i++) { lit_len_code[i].len = 8; }
+
+      lengthsToCodes(lit_len_code, 288);
+
+      for(unsigned i = 0; i < DISTANCE_CODES; i++) { dist_code[i].len = 5; }
+
+      lengthsToCodes(dist_code, DISTANCE_CODES);
+   }
+
+   //! Size in bits of the block symbols with the current codes
+   uint64_t symbolBits(const uint32_t* lit_freq, const uint32_t* dist_freq) const
+   {
+      uint64_t bits = 0;
+
+      for(unsigned i = 0; i < LIT_LEN_CODES; i++)
+      {
+         bits += uint64_t(lit_freq[i]) * lit_len_code[i].len;
+
+         if (i > END_OF_BLOCK_LIT)
+         {
+            bits += uint64_t(lit_freq[i]) * lenExtra()[i - END_OF_BLOCK_LIT - 1].bits;
+         }
+      }
+
+      for(unsigned i = 0; i < DISTANCE_CODES; i++)
+      {
+         bits += uint64_t(dist_freq[i]) * (dist_code[i].len + distExtra()[i].bits);
+      }
+
+      return bits;
+   }
+
+   //! Run length encode the code lengths \return number of code length symbols
+   unsigned encodeLengths(const uint8_t* lengths, unsigned num, uint8_t* rle, uint8_t* extra)
+   {
+      unsigned n = 0;
+
+      for(unsigned i = 0; i < num; )
+      {
+         uint8_t  len = lengths[i];
+         unsigned run = 1;
+
+         while(((i + run) < num) && (lengths[i + run] == len)) run++;
+
+         if (len == 0 && run >= 3)
+         {
+            run = std::min(run, 138u);
+
+            rle[n]     = run >= 11 ? 18 : 17;
+            extra[n++] = run >= 11 ? run - 11 : run - 3;
+         }
+         else if (len != 0 && run >= 4)
+         {
+            // First length sent explicitly then repeated
+            run = std::min(run, 7u);
+
+            rle[n]     = len;
+            extra[n++] = 0;
+            rle[n]     = 16;
+            extra[n++] = run - 1 - 3;
+         }
+         else
+         {
+            run        = 1;
+            rle[n]     = len;
+            extra[n++] = 0;
+         }
+
+         i += run;
+      }
+
+      return n;
+   }
+
+   //! Send block symbols with the current codes
+   void putSymbols()
+   {
+      for(unsigned i = 0; i < num_symbols; i++)
+      {
+         const Symbol& s = symbols[i];
+
+         if (s.dist == 0)
+         {
+            putCode(lit_len_code[s.lit_len]);
+         }
+         else
+         {
+            unsigned li = lenIndex(s.lit_len);
+            putCode(lit_len_code[END_OF_BLOCK_LIT + 1 + li]);
+            putBits(s.lit_len - lenExtra()[li].base, lenExtra()[li].bits);
+
+            unsigned di = distIndex(s.dist);
+            putCode(dist_code[di]);
+            putBits(s.dist - distExtra()[di].base, distExtra()[di].bits);
+         }
+      }
+
+      putCode(lit_len_code[END_OF_BLOCK_LIT]);
+   }
+
+   //! Compress the buffered symbols into a block
+   void emitBlock(bool final)
+   {
+      uint32_t lit_freq[LIT_LEN_CODES]   = {};
+      uint32_t dist_freq[DISTANCE_CODES] = {};
+
+      for(unsigned i = 0; i < num_symbols; i++)
+      {
+         const Symbol& s = symbols[i];
+
+         if (s.dist == 0)
+         {
+            lit_freq[s.lit_len]++;
+         }
+         else
+         {
+            lit_freq[END_OF_BLOCK_LIT + 1 + lenIndex(s.lit_len)]++;
+            dist_freq[distIndex(s.dist)]++;
+         }
+      }
+
+      lit_freq[END_OF_BLOCK_LIT]++;
+
+      fixedCodes();
+      uint64_t fixed_bits = symbolBits(lit_freq, dist_freq);
+
+      if (level == DYNAMIC)
+      {
+         // Keep both codes complete
+         uint32_t dyn_lit_freq[LIT_LEN_CODES];
+         uint32_t dyn_dist_freq[DISTANCE_CODES];
+
+         memcpy(dyn_lit_freq,  lit_freq,  sizeof(lit_freq));
+         memcpy(dyn_dist_freq, dist_freq, sizeof(dist_freq));
+
+         if (std::count_if(dyn_lit_freq, dyn_lit_freq + LIT_LEN_CODES, [](uint32_t f){ return f != 0; }) < 2)
+         {
+            dyn_lit_freq[0]++;
+         }
+
+         unsigned dist_used = std::count_if(dyn_dist_freq, dyn_dist_freq + DISTANCE_CODES, [](uint32_t f){ return f != 0; });
+         if (dist_used < 2)
+         {
+            dyn_dist_freq[0] += dyn_dist_freq[0] == 0;
+            dyn_dist_freq[1] += dyn_dist_freq[1] == 0;
+         }
+
+         HuffCode dyn_lit[LIT_LEN_CODES];
+         HuffCode dyn_dist[DISTANCE_CODES];
+
+         buildLengths(dyn_lit,  dyn_lit_freq,  LIT_LEN_CODES,  MAX_BITS);
+         buildLengths(dyn_dist, dyn_dist_freq, DISTANCE_CODES, MAX_BITS);
+
+         // Code lengths as one sequence
+         unsigned hlit  = LIT_LEN_CODES;
+         unsigned hdist = DISTANCE_CODES;
+
+         while(dyn_lit[hlit - 1].len == 0)   hlit--;
+         while(dyn_dist[hdist - 1].len == 0) hdist--;
+
+         uint8_t lengths[LIT_LEN_CODES + DISTANCE_CODES];
+
+         for(unsigned i = 0; i < hlit;  i++) lengths[i]        = dyn_lit[i].len;
+         for(unsigned i = 0; i < hdist; i++) lengths[hlit + i] = dyn_dist[i].len;
+
+         uint8_t  rle[LIT_LEN_CODES + DISTANCE_CODES];
+         uint8_t  rle_extra[LIT_LEN_CODES + DISTANCE_CODES];
+         unsigned num_rle = encodeLengths(lengths, hlit + hdist, rle, rle_extra);
+
+         uint32_t cl_freq[CODE_LEN_CODES] = {};
+         for(unsigned i = 0; i < num_rle; i++) cl_freq[rle[i]]++;
+
+         HuffCode cl_code[CODE_LEN_CODES];
+         buildLengths(cl_code, cl_freq, CODE_LEN_CODES, MAX_CODE_LEN_BITS);
+
+         static const uint8_t code_length_order[CODE_LEN_CODES] =
+         {
+            16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+         };
+
+         unsigned hclen = CODE_LEN_CODES;
+         while((hclen > 4) && (cl_code[code_length_order[hclen - 1]].len == 0)) hclen--;
+
+         // Header cost
+         static const uint8_t rle_extra_bits[3] = {2, 3, 7};
+
+         uint64_t dyn_bits = 5 + 5 + 4 + 3 * hclen;
+         for(unsigned i = 0; i < num_rle; i++)
+         {
+            dyn_bits += cl_code[rle[i]].len + (rle[i] >= 16 ? rle_extra_bits[rle[i] - 16] : 0);
+         }
+
+         // Compare with the fixed codes already in lit_len_code/dist_code
+         HuffCode fixed_lit[LIT_LEN_CODES];
+         HuffCode fixed_dist[DISTANCE_CODES];
+
+         memcpy(fixed_lit,  lit_len_code, sizeof(fixed_lit));
+         memcpy(fixed_dist, dist_code,    sizeof(fixed_dist));
+         memcpy(lit_len_code, dyn_lit,    sizeof(dyn_lit));
+         memcpy(dist_code,    dyn_dist,   sizeof(dyn_dist));
+
+         dyn_bits += symbolBits(lit_freq, dist_freq);
+
+         if (dyn_bits < fixed_bits)
+         {
+            putBits(final ? 1 : 0, 1);
+            putBits(0b10, 2);
+
+            putBits(hlit - 257, 5);
+            putBits(hdist - 1, 5);
+            putBits(hclen - 4, 4);
+
+            for(unsigned i = 0; i < hclen; i++)
+            {
+               putBits(cl_code[code_length_order[i]].len, 3);
+            }
+
+            for(unsigned i = 0; i < num_rle; i++)
+            {
+               putCode(cl_code[rle[i]]);
+
+               if (rle[i] >= 16)
+               {
+                  putBits(rle_extra[i], rle_extra_bits[rle[i] - 16]);
+               }
+            }
+
+            putSymbols();
+            num_symbols = 0;
+            return;
+         }
+
+         memcpy(lit_len_code, fixed_lit,  sizeof(fixed_lit));
+         memcpy(dist_code,    fixed_dist, sizeof(fixed_dist));
+      }
+
+      putBits(final ? 1 : 0, 1);
+      putBits(0b01, 2);
+
+      putSymbols();
+      num_symbols = 0;
+   }
+
+   // I/O state
+   Deflate::Io*          io{nullptr};
+   Deflate::Level        level;
+   bool                  end_of_input{false};
+   uint64_t              bit_buffer{0};
+   unsigned              buffer_bits{0};
+   uint8_t               out_buffer[512];
+   size_t                out_len{0};
+   size_t                bytes_out{0};
+
+   // Input window and look-ahead
+   size_t                window_size;
+   std::vector<uint8_t>  buffer;
+   size_t                buffer_end{0};
+   size_t                pos{0};       //!< Next byte to encode in buffer
+   size_t                base{0};      //!< Stream offset of buffer[0]
+
+   // Hash chains, stream offsets of earlier strings with the same hash
+   unsigned              hash_bits;
+   std::vector<uint32_t> head;
+   std::vector<uint32_t> prev;
+
+   // Block being built
+   std::vector<Symbol>   symbols;
+   unsigned              num_symbols{0};
+   HuffCode              lit_len_code[288];
+   HuffCode              dist_code[DISTANCE_CODES];
+};
+
+
+size_t Deflate::deflate(Level level_, size_t log2_window_size)
+{
+   Encoder encoder{io, level_, log2_window_size};
+
+   return encoder.deflate();
+}
+
+} // namespace STB
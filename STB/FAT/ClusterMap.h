@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace STB {
+
+namespace FAT {
+
+//! Reverse map from a data cluster to the file that contains it
+//
+//! Built from the directory and FAT so that finding the file for a
+//! sector is a constant time look-up rather than a walk of every cluster
+//! chain. Rebuild whenever either table changes
+template <unsigned NUM_CLUSTERS, unsigned NUM_ENTRIES>
+class ClusterMap
+{
+public:
+   ClusterMap()
+   {
+      clear();
+   }
+
+   //! Forget all files
+   void clear()
+   {
+      for(unsigned i = 0; i < NUM_CLUSTERS; ++i)
+         file[i] = NONE;
+   }
+
+   //! Rebuild the map from a directory and FAT
+   template <typename DIR, typename TABLE>
+   void build(const DIR& dir_, const TABLE& fat_)
+   {
+      clear();
+
+      for(unsigned i = 0; i < NUM_ENTRIES; ++i)
+      {
+         if (dir_[i].isEmpty())
+            continue;
+
+         uint32_t cluster = dir_[i].getCluster();
+
+         // Bound the walk as the host may have written a broken chain
+         for(unsigned j = 0; (cluster >= FIRST) && (cluster < LIMIT) && (j < NUM_CLUSTERS); j++)
+         {
+            // The first file to claim a cluster wins, as with a linear search
+            if (file[cluster] != NONE)
+               break;
+
+            file[cluster] = i;
+            seq[cluster]  = j;
+
+            cluster = fat_[cluster];
+         }
+      }
+   }
+
+   //! Find the directory entry and position in its chain for a cluster
+   bool find(uint32_t  cluster_,
+             unsigned& dir_index_,
+             unsigned& cluster_seq_) const
+   {
+      if ((cluster_ >= NUM_CLUSTERS) || (file[cluster_] == NONE))
+         return false;
+
+      dir_index_   = file[cluster_];
+      cluster_seq_ = seq[cluster_];
+      return true;
+   }
+
+private:
+   using Index = uint8_t;
+
+   static_assert(NUM_ENTRIES < 0xFF);
+   static_assert(NUM_CLUSTERS <= 0x10000);
+
+   static constexpr Index    NONE  = 0xFF;
+   static constexpr uint32_t FIRST = 2;   //!< First data cluster
+   static constexpr uint32_t LIMIT = NUM_CLUSTERS < 0xFFF8 ? NUM_CLUSTERS : 0xFFF8;
+
+   Index    file[NUM_CLUSTERS];        //!< Directory entry for each cluster
+   uint16_t seq[NUM_CLUSTERS]  = {};   //!< Position of each cluster in its chain
+};
+
+} // namespace FAT
+
+} // namespace STB
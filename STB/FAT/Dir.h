@@ -106,7 +106,7 @@ public:
          entry[0].setVolumeLabel(volume_label_);
    }
 
-   const DirEntry& operator[](unsigned index_) { return entry[index_]; }
+   const DirEntry& operator[](unsigned index_) const { return entry[index_]; }
 
    void read(unsigned offset_, unsigned bytes_, uint8_t* buffer_) const
    {
@@ -128,36 +128,6 @@ public:
       return index;
    }
 
-   //! Find a directory entry that contains the given cluster
-   template <typename FAT>
-   bool findFile(uint32_t   search_cluster_,
-                 const FAT& fat_,
-                 unsigned&  dir_index_,
-                 unsigned&  cluster_seq_) const
-   {
-      for(unsigned i = 0; i < NUM_ENTRIES; ++i)
-      {
-         if (not entry[i].isEmpty())
-         {
-            uint32_t cluster = entry[i].getCluster();
-
-            for(unsigned j = 0; cluster < 0xFFF8; j++)
-            {
-               if (cluster == search_cluster_)
-               {
-                  dir_index_   = i;
-                  cluster_seq_ = j;
-                  return true;
-               }
-
-               cluster = fat_[cluster];
-            }
-         }
-      }
-
-      return false;
-   }
-
 private:
    //! Find an empty entry
    signed alloc() const
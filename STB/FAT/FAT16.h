@@ -10,6 +10,7 @@
 #include "STB/FileSystem.h"
 #include "STB/FAT/Table.h"
 #include "STB/FAT/Dir.h"
+#include "STB/FAT/ClusterMap.h"
 
 namespace STB {
 
@@ -35,6 +36,8 @@ public:
       {
          dir_entry_data[index] = raw_data_;
       }
+
+      cluster_map.build(root_dir, fat);
    }
 
    void newFileBuffer(uint8_t* buffer_, unsigned limit_)
@@ -50,12 +53,12 @@ public:
       unsigned dir_index;
       unsigned cluster_seq;
 
-      if (root_dir.findFile(cluster, fat, dir_index, cluster_seq))
+      if (cluster_map.find(cluster, dir_index, cluster_seq))
       {
          if (dir_entry_data[dir_index] != nullptr)
          {
-            uint32_t cluster_offset = ((sector_ - LBA_DATA) % SECTORS_PER_CLUSTER);
-            uint32_t data_offset    = cluster_offset + cluster_seq * BYTES_PER_CLUSTER;
+            uint32_t sector_offset = ((sector_ - LBA_DATA) % SECTORS_PER_CLUSTER);
+            uint32_t data_offset   = sector_offset * BYTES_PER_SECTOR + cluster_seq * BYTES_PER_CLUSTER;
 
             return dir_entry_data[dir_index] + data_offset;
          }
@@ -133,18 +136,21 @@ public:
          unsigned fat_offset = (sector_ - LBA_FAT1) * BYTES_PER_SECTOR + offset_;
 
          fat.write(fat_offset, bytes_, buffer_);
+         map_stale = true;
       }
       else if ((sector_ >= LBA_FAT2) && (sector_ < LBA_ROOT_DIR))
       {
          unsigned fat_offset = (sector_ - LBA_FAT2) * BYTES_PER_SECTOR + offset_;
 
          fat.write(fat_offset, bytes_, buffer_);
+         map_stale = true;
       }
       else if ((sector_ >= LBA_ROOT_DIR) && (sector_ < LBA_DATA))
       {
          unsigned dir_offset = (sector_ - LBA_ROOT_DIR) * BYTES_PER_SECTOR + offset_;
 
          root_dir.write(dir_offset, bytes_, buffer_);
+         map_stale = true;
 
          if (dir_offset == 0)
          {
@@ -199,6 +205,12 @@ private:
 
    void endOfWrite() override
    {
+      if (map_stale)
+      {
+         cluster_map.build(root_dir, fat);
+         map_stale = false;
+      }
+
       if (write_mode == COMPLETE)
       {
          newFile(write_offset);
@@ -321,6 +333,8 @@ private:
    VBR                            vbr;
    FAT::Table16<NUM_CLUSTERS>     fat{};
    FAT::Dir<MAX_ROOT_DIR_ENTRIES> root_dir;
+   FAT::ClusterMap<NUM_CLUSTERS, MAX_ROOT_DIR_ENTRIES> cluster_map;
+   bool                           map_stale{false};   //!< FAT or directory written since last map build
    uint8_t*                       dir_entry_data[MAX_ROOT_DIR_ENTRIES] = {};
    FileMode                       read_mode{ARMED};
    const uint8_t*                 read_ptr{nullptr};
@@ -11,7 +11,7 @@
 
 namespace STB {
 
-size_t ZLib::inflate()
+unsigned ZLib::readHeader()
 {
    static const unsigned ZLIB_CM_DEFLATE = 8;
 
@@ -28,41 +28,132 @@ size_t ZLib::inflate()
       return 0;
    }
 
-   size_t size = 0;
+   if (compression_method != ZLIB_CM_DEFLATE)
+   {
+      error("compression method must be DEFLATE");
+      return 0;
+   }
+
+   adler = 1;
+
+   return 8 + compression_info;
+}
 
-   adler32reset();
+void ZLib::checkTrailer()
+{
+   uint8_t trailer[4];
 
-   switch(compression_method)
+   if (stream.readTail(trailer, sizeof(trailer)) != sizeof(trailer))
    {
-   case ZLIB_CM_DEFLATE:
-      {
-         Deflate  deflate{this};
-         unsigned log2_window_size = 8 + compression_info;
+      error("ZLIB missing Adler-32");
+      return;
+   }
+
+   uint32_t adler32;
+   adler32  = trailer[0] << 24;
+   adler32 |= trailer[1] << 16;
+   adler32 |= trailer[2] << 8;
+   adler32 |= trailer[3];
+
+   if (adler32 != adler)
+   {
+      error("CRC failure");
+   }
+}
+
+size_t ZLib::inflate()
+{
+   unsigned log2_window_size = readHeader();
+   if (log2_window_size == 0)
+   {
+      return 0;
+   }
+
+   size_t size = stream.inflate(log2_window_size);
+
+   if (!failed)
+   {
+      checkTrailer();
+   }
+
+   state = END;
 
-         size = deflate.inflate(log2_window_size);
+   return failed ? 0 : size;
+}
+
+size_t ZLib::inflate(uint8_t* out_, size_t size_)
+{
+   if (state == START)
+   {
+      unsigned log2_window_size = readHeader();
+      if (log2_window_size == 0)
+      {
+         state = END;
+         return 0;
       }
-      break;
 
-   default:
-      error("compression method must be DEFLATE");
-      break;
+      // Window size is fixed by the first call
+      (void) stream.inflate(out_, 0, log2_window_size);
+
+      state = BODY;
    }
 
-   if (size != 0)
+   if (state == END)
    {
-      uint32_t adler32;
-      adler32  = getByte() << 24;
-      adler32 |= getByte() << 16;
-      adler32 |= getByte() << 8;
-      adler32 |= getByte();
+      return 0;
+   }
+
+   size_t n = stream.inflate(out_, size_);
+
+   adler = adler32(adler, out_, n);
 
-      if (adler32 != adler32crc())
+   if (n < size_)
+   {
+      if (!failed)
       {
-         error("CRC failure");
+         checkTrailer();
       }
-    }
 
-   return size;
+      state = END;
+   }
+
+   return n;
 }
 
+size_t ZLib::deflate(Deflate::Level level_, unsigned log2_window_size_)
+{
+   static const unsigned ZLIB_CM_DEFLATE = 8;
+
+   if (log2_window_size_ < 8)  log2_window_size_ = 8;
+   if (log2_window_size_ > 15) log2_window_size_ = 15;
+
+   // FLEVEL 0 fastest .. 3 maximum compression
+   unsigned flevel = level_ == Deflate::STORE ? 0 :
+                     level_ == Deflate::FIXED ? 1 : 2;
+
+   uint8_t header[2];
+   header[0] = ((log2_window_size_ - 8) << 4) | ZLIB_CM_DEFLATE;
+   header[1] = flevel << 6;
+   header[1] += 31 - ((header[0] << 8) | header[1]) % 31;
+
+   io->write(header, sizeof(header));
+
+   compress = true;
+   adler    = 1;
+
+   size_t size = stream.deflate(level_, log2_window_size_);
+
+   compress = false;
+
+   uint8_t trailer[4];
+   trailer[0] = uint8_t(adler >> 24);
+   trailer[1] = uint8_t(adler >> 16);
+   trailer[2] = uint8_t(adler >> 8);
+   trailer[3] = uint8_t(adler);
+
+   io->write(trailer, sizeof(trailer));
+
+   return sizeof(header) + size + sizeof(trailer);
 }
+
+} // namespace STB
@@ -15,53 +15,97 @@ class ZLib : public Deflate::Io
 {
 public:
    using Io = Deflate::Io;
-   
+
    ZLib(Io* io_) : io(io_) {}
-   
-   //! Inflate Z-lib I/O stream
-   size_t inflate(); 
 
-private:
-   void adler32reset()
-   {
-      crc_lsh = 1;
-      crc_msh = 0;
-   }
+   //! Inflate Z-lib I/O stream passing all output to Io::write()
+   size_t inflate();
+
+   //! Inflate the next part of a Z-lib stream into a buffer
+   //
+   //! Repeated calls resume where the previous call finished
+   //! \return bytes written, less than size_ only at the end of the stream or on error
+   size_t inflate(uint8_t* out_, size_t size_);
 
-   //! Update CRC using the Adler-32 algorithm
-   void adler32update(uint8_t byte)
+   //! Compress all input from Io::read() into a Z-lib stream passed to Io::write()
+   //
+   //! An Io that only implements getByte() signals the end of input with atEnd()
+   //! \return size of the compressed stream
+   size_t deflate(Deflate::Level level_ = Deflate::DYNAMIC, unsigned log2_window_size_ = 15);
+
+   //! Update an Adler-32 checksum with a span of data
+   static uint32_t adler32(uint32_t adler_, const uint8_t* data_, size_t size_)
    {
       static const uint32_t ADLER32_BASE = 65521; // Largest prime smaller that 65536
+      static const size_t   ADLER32_NMAX = 5552;  // Most bytes before the sums can overflow
 
-      crc_lsh = (crc_lsh + byte) % ADLER32_BASE;
-      crc_msh = (crc_lsh + crc_msh) % ADLER32_BASE;
-   }
+      uint32_t lsh = adler_ & 0xFFFF;
+      uint32_t msh = adler_ >> 16;
 
-   uint32_t adler32crc() const
-   {
-      return (crc_msh << 16) | crc_lsh;
+      while(size_ != 0)
+      {
+         size_t n = size_ < ADLER32_NMAX ? size_ : ADLER32_NMAX;
+         size_   -= n;
+
+         for(size_t i = 0; i < n; i++)
+         {
+            lsh += data_[i];
+            msh += lsh;
+         }
+
+         data_ += n;
+
+         lsh %= ADLER32_BASE;
+         msh %= ADLER32_BASE;
+      }
+
+      return (msh << 16) | lsh;
    }
 
-   virtual uint8_t getByte() override
+private:
+   //! Read and check the stream header \return log2 of the window size or 0
+   unsigned readHeader();
+
+   //! Read and check the Adler-32 trailer
+   void checkTrailer();
+
+   // The checksum covers the uncompressed side of the stream
+   size_t read(uint8_t* data_, size_t size_) override
    {
-      return io->getByte();
+      size_t len = io->read(data_, size_);
+
+      if (compress)
+      {
+         adler = adler32(adler, data_, len);
+      }
+
+      return len;
    }
 
-   virtual void putByte(uint8_t byte) override
+   void write(const uint8_t* data_, size_t size_) override
    {
-      adler32update(byte);
-      io->putByte(byte);
+      if (!compress)
+      {
+         adler = adler32(adler, data_, size_);
+      }
+
+      io->write(data_, size_);
    }
 
-   virtual void error(const std::string& message) override
+   void error(const std::string& message) override
    {
+      failed = true;
       io->error(message);
    }
 
+   enum State { START, BODY, END };
+
    Io*      io{nullptr};
-   uint32_t crc_lsh{0};
-   uint32_t crc_msh{0};
+   Deflate  stream{this};
+   State    state{START};
+   bool     failed{false};
+   bool     compress{false};
+   uint32_t adler{1};
 };
 
 } // namespace STB
-
@@ -0,0 +1,347 @@
+//-------------------------------------------------------------------------------
+// Copyright (c) 2026 John D. Haughton
+// SPDX-License-Identifier: MIT
+//-------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "STB/Zlib.h"
+
+#include "STB/Test.h"
+
+// Streams compressed with zlib 1.2.13 from testData()
+
+static const uint8_t zlib_stored[] =
+{
+   0x78, 0x01, 0x01, 0x40, 0x00, 0xbf, 0xff, 0x61, 0x56, 0x72, 0x40, 0x41, 0x71, 0xa0, 0xaa, 0x3d,
+   0xcc, 0x24, 0xd4, 0x10, 0x1a, 0x3c, 0x7b, 0x00, 0x78, 0x1d, 0xb1, 0x28, 0x3a, 0x09, 0x29, 0x1a,
+   0x61, 0x42, 0x01, 0x2b, 0x07, 0x08, 0x32, 0x41, 0x3a, 0x04, 0x3b, 0xb6, 0x3a, 0x20, 0x9f, 0x12,
+   0x39, 0x11, 0x03, 0x25, 0x5c, 0x12, 0x57, 0xd4, 0x10, 0x1a, 0x3c, 0x7b, 0x00, 0x78, 0x1d, 0xb1,
+   0x28, 0x3a, 0x09, 0x29, 0x1a, 0x61, 0x42, 0x67, 0x4e, 0x11, 0x4a,
+};
+
+static const uint8_t zlib_fixed[] =
+{
+   0x78, 0xda, 0x4b, 0x0c, 0x2b, 0x72, 0x70, 0x2c, 0x5c, 0xb0, 0xca, 0xf6, 0x8c, 0xca, 0x15, 0x01,
+   0x29, 0x9b, 0x6a, 0x86, 0x0a, 0xd9, 0x8d, 0x1a, 0x56, 0x9c, 0x9a, 0x52, 0x89, 0x4e, 0x8c, 0xda,
+   0xec, 0x1c, 0x46, 0x8e, 0x56, 0x2c, 0xd6, 0xdb, 0xac, 0x14, 0xe6, 0x03, 0x00, 0x0c, 0xc0, 0x0b,
+   0xb5,
+};
+
+static const uint8_t zlib_dynamic[] =
+{
+   0x78, 0xda, 0x65, 0xca, 0x5b, 0x6c, 0x52, 0x67, 0x00, 0x00, 0xe0, 0xff, 0x3f, 0xff, 0xb9, 0x42,
+   0x81, 0xc3, 0x01, 0x0e, 0x97, 0xd2, 0x71, 0x11, 0x6c, 0x0f, 0xa7, 0x50, 0x90, 0x02, 0x03, 0x8a,
+   0xf4, 0x02, 0xf4, 0x40, 0xa5, 0x2d, 0x52, 0xda, 0x02, 0xd2, 0xa4, 0x51, 0xe9, 0xd5, 0xcc, 0xb5,
+   0x4b, 0xd6, 0x59, 0x53, 0xaf, 0x71, 0xed, 0xa2, 0xa6, 0x0f, 0x6a, 0x63, 0x9c, 0x9d, 0xd7, 0xc4,
+   0x2c, 0x73, 0xb3, 0x0f, 0xad, 0x99, 0x59, 0xe2, 0xfd, 0xc1, 0xc4, 0xc6, 0x17, 0x63, 0xd4, 0xcd,
+   0x27, 0xb7, 0xa7, 0x2d, 0x7b, 0x5a, 0xf6, 0xbc, 0xf7, 0xb3, 0xef, 0xf9, 0x1b, 0x1f, 0x9e, 0xeb,
+   0xec, 0xfa, 0xfc, 0xda, 0xf7, 0x89, 0x97, 0xae, 0xd7, 0xac, 0xa5, 0x63, 0x11, 0x2c, 0x34, 0x6d,
+   0xb4, 0xc4, 0x18, 0xc1, 0x32, 0xde, 0x0d, 0x45, 0x8a, 0xde, 0xd5, 0x15, 0xc3, 0xe3, 0x5b, 0x31,
+   0xfb, 0x77, 0x5c, 0x54, 0x8b, 0xdc, 0xfb, 0xb8, 0x11, 0x79, 0xea, 0xa0, 0xec, 0x3c, 0x78, 0x23,
+   0x7d, 0xa5, 0xfb, 0x70, 0x84, 0xad, 0x18, 0x4b, 0xd9, 0x57, 0xc2, 0x25, 0xbf, 0xa5, 0x72, 0x76,
+   0x22, 0x8d, 0x9d, 0x30, 0x92, 0x66, 0xeb, 0x6c, 0x26, 0xda, 0x4b, 0x39, 0xd7, 0xf4, 0x93, 0xe0,
+   0x33, 0x49, 0x97, 0x04, 0xf0, 0xa4, 0x3c, 0xfd, 0xc2, 0x2a, 0xd9, 0x7f, 0xb1, 0xda, 0xa9, 0xa6,
+   0x19, 0x1a, 0xb3, 0xfe, 0x44, 0x0c, 0x4a, 0x30, 0x2c, 0x3d, 0x04, 0x98, 0x06, 0x6f, 0xa7, 0x1f,
+   0x34, 0x5e, 0x46, 0x28, 0x08, 0xd3, 0xbe, 0xf4, 0x34, 0x1a, 0x08, 0x87, 0xcc, 0xc1, 0x13, 0xe1,
+   0xa9, 0xff, 0x25, 0x44, 0xaa, 0x96, 0xce, 0x97, 0x1f, 0x6b, 0x50, 0xd2, 0x4a, 0xf2, 0x8c, 0x52,
+   0x98, 0xcc, 0xd3, 0x25, 0x46, 0x3f, 0x33, 0x69, 0x7c, 0x92, 0x22, 0x2f, 0x16, 0xc0, 0xda, 0xf5,
+   0xed, 0x2f, 0x27, 0x56, 0x93, 0x86, 0x51, 0xcb, 0xf9, 0x70, 0xe4, 0xae, 0x8f, 0x5b, 0x90, 0x27,
+   0xe2, 0xc6, 0xc4, 0x10, 0x23, 0xd6, 0x03, 0x8b, 0x97, 0x0a, 0x0c, 0x37, 0x75, 0xab, 0xae, 0x3e,
+   0xae, 0xf1, 0xe4, 0xdb, 0x7d, 0xc4, 0x85, 0x5a, 0x76, 0x2c, 0xb1, 0xe8, 0x7f, 0xb7, 0xc3, 0x16,
+   0x10, 0xb4, 0xf8, 0x06, 0xdc, 0xf4, 0xaa, 0x03, 0x17, 0x10, 0x62, 0xe4, 0xe9, 0x4e, 0xcc, 0x17,
+   0xe1, 0x81, 0xdd, 0x04, 0x09, 0x09, 0x02, 0x65, 0x24, 0x85, 0x22, 0xd5, 0xbe, 0x61, 0xdb, 0x3c,
+   0x55, 0x04, 0x34, 0x82, 0xf1, 0x9a, 0xa6, 0x00, 0xcd, 0x7b, 0x1a, 0xa4, 0x37, 0x7d, 0x7b, 0x5a,
+   0x1b, 0x3e, 0x6d, 0xfe, 0x42, 0xbf, 0x4f, 0x9e, 0xd2, 0x30, 0x0c, 0x4d, 0x0c, 0x74, 0x1b, 0xe6,
+   0x0d, 0x3b, 0x41, 0x74, 0x55, 0x2c, 0x63, 0xc6, 0x2a, 0x86, 0x53, 0x3f, 0x9f, 0x31, 0x28, 0x7a,
+   0x5c, 0xa9, 0x5d, 0x80, 0xfb, 0x1a, 0x38, 0xc8, 0xac, 0xc7, 0xfc, 0x1b, 0x80, 0x62, 0xff, 0xca,
+   0x6d, 0x51, 0x9e, 0x06, 0x74, 0x1d, 0xbe, 0x39, 0x1a, 0xcf, 0xbc, 0xab, 0x6d, 0x4f, 0x5d, 0x55,
+   0x24, 0xaf, 0xe2, 0xe5, 0x43, 0xd9, 0x36, 0xdb, 0x0d, 0x94, 0x99, 0xa3, 0x04, 0xde, 0xdb, 0x4c,
+   0x6c, 0xb5, 0x80, 0xa0, 0xda, 0x29, 0x48, 0xc6, 0x63, 0xcb, 0xf0, 0xd4, 0x69, 0x87, 0x28, 0x4f,
+   0xa3, 0x30, 0xe7, 0xd0, 0xed, 0xe5, 0xc8, 0xfa, 0x9f, 0x8f, 0xda, 0xa1, 0x6d, 0x44, 0x37, 0xaa,
+   0x83, 0x68, 0xd4, 0x66, 0xdf, 0x9f, 0x30, 0xaf, 0xd7, 0xea, 0xf8, 0x65, 0x16, 0x10, 0x26, 0x4c,
+   0x7b, 0xa7, 0xa2, 0x65, 0xd6, 0xa2, 0xf6, 0xe3, 0x52, 0xce, 0x2a, 0x4f, 0x3d, 0xfe, 0xc8, 0x76,
+   0xc0, 0x98, 0x05, 0x7f, 0xe1, 0xcb, 0x81, 0x52, 0xf0, 0xa3, 0xaa, 0x49, 0x72, 0x0a, 0x07, 0x4c,
+   0x5c, 0x5d, 0xcf, 0x9b, 0x4b, 0x7e, 0xf2, 0x6f, 0x7c, 0x7f, 0x3f, 0x18, 0xe3, 0x7f, 0xe0, 0xa8,
+   0xcd, 0x0c, 0xa8, 0xec, 0x00, 0x34, 0x23, 0x4f, 0x9b, 0x6b, 0xd5, 0xec, 0x60, 0xd4, 0x7f, 0x08,
+   0x99, 0x79, 0xbe, 0xc1, 0x62, 0x1d, 0xa7, 0xcf, 0x82, 0xf7, 0x8a, 0xf5, 0x7f, 0xa2, 0x85, 0x3e,
+   0xfe, 0x76, 0x63, 0x64, 0xf3, 0xe6, 0x80, 0x70, 0xf0, 0x5e, 0xe3, 0xaf, 0x07, 0x56, 0xca, 0x99,
+   0x3f, 0x74, 0x85, 0x54, 0x50, 0x90, 0x27, 0x75, 0xb8, 0x69, 0xaf, 0x8d, 0x24, 0x9d, 0xa0, 0xab,
+   0x08, 0x3c, 0x90, 0x8b, 0x4e, 0xeb, 0x42, 0xc0, 0x03, 0xbe, 0xf9, 0x36, 0x79, 0x4e, 0xec, 0x08,
+   0xb7, 0xad, 0x17, 0x71, 0x57, 0x7c, 0x8a, 0x13, 0x00, 0xd7, 0x6b, 0x98, 0x5d, 0x50, 0xa1, 0xb8,
+   0x52, 0x9e, 0x38, 0xbb, 0xa9, 0x78, 0x6c, 0xc2, 0xeb, 0xb5, 0xc0, 0x66, 0x63, 0x48, 0x54, 0x56,
+   0xc4, 0xe8, 0xf3, 0xde, 0x3c, 0x73, 0x70, 0xc8, 0xef, 0x3d, 0x33, 0x92, 0xd8, 0x4d, 0xb7, 0x75,
+   0x2e, 0xe6, 0xfb, 0xa0, 0x9b, 0xc0, 0x15, 0x8e, 0x14, 0xf6, 0x23, 0xa8, 0xba, 0xe4, 0xe9, 0xae,
+   0x21, 0x6e, 0xf7, 0xba, 0xda, 0x54, 0x8f, 0x14, 0xe0, 0x24, 0x07, 0x12, 0x6c, 0x59, 0x7d, 0xa4,
+   0x3b, 0x17, 0xcc, 0x89, 0xec, 0xd3, 0x88, 0x95, 0xd5, 0x08, 0xf3, 0x47, 0xc9, 0x69, 0xc7, 0x6c,
+   0x27, 0xdc, 0xd9, 0x12, 0x0b, 0x92, 0xb9, 0xa2, 0x44, 0xc8, 0xd3, 0xd0, 0x53, 0x85, 0xfe, 0xb4,
+   0x3d, 0x35, 0xf6, 0x10, 0xc5, 0x4a, 0xd6, 0x42, 0x1a, 0x39, 0x7f, 0x07, 0xc4, 0x8b, 0xca, 0x5b,
+   0x2d, 0x15, 0xaa, 0x24, 0x80, 0xc7, 0x44, 0xf9, 0x11, 0xe4, 0x9e, 0x2d, 0x51, 0x87, 0x0f, 0xab,
+   0x43, 0x55, 0xea, 0xe8, 0xb3, 0xfb, 0xf2, 0x54, 0x5e, 0x4a, 0x3d, 0xd0, 0x9b, 0x66, 0xcd, 0xcb,
+   0x2b, 0x49, 0x15, 0xd6, 0x30, 0x0c, 0x66, 0x5a, 0x15, 0xf8, 0x93, 0x9e, 0x40, 0x2b, 0x03, 0x82,
+   0xc9, 0x75, 0x70, 0x71, 0x83, 0xed, 0x71, 0xe7, 0x53, 0xee, 0xdd, 0xbd, 0x58, 0x3f, 0xcf, 0xf9,
+   0xae, 0x18, 0x3f, 0x91, 0xa7, 0xff, 0x00, 0xa0, 0x11, 0xfc, 0x52,
+};
+
+//! Pseudo random data with a skewed byte distribution and some repeats
+static std::vector<uint8_t> testData(unsigned n)
+{
+   std::vector<uint8_t> data;
+   uint32_t             x = 1;
+
+   for(unsigned i = 0; i < n; i++)
+   {
+      x = x * 1103515245 + 12345;
+
+      unsigned a = (x >> 16) & 0xFF;
+      unsigned b = (x >> 8) & 0xFF;
+
+      if ((i % 64) < 48)
+         data.push_back((a * b) >> 8);
+      else if (i >= 37)
+         data.push_back(data[i - 37]);
+      else
+         data.push_back(a);
+   }
+
+   return data;
+}
+
+class MemIo : public STB::ZLib::Io
+{
+public:
+   MemIo(const uint8_t* data_, size_t size_)
+      : data(data_)
+      , size(size_)
+   {
+   }
+
+   uint8_t getByte() override
+   {
+      if (index == size)
+      {
+         ++overrun;
+         return 0;
+      }
+
+      return data[index++];
+   }
+
+   bool atEnd() override
+   {
+      return index == size;
+   }
+
+   void putByte(uint8_t byte_) override
+   {
+      out.push_back(byte_);
+   }
+
+   void error(const std::string& message_) override
+   {
+      errors.push_back(message_);
+   }
+
+   const uint8_t*           data;
+   size_t                   size;
+   size_t                   index{0};
+   unsigned                 overrun{0};
+   std::vector<uint8_t>     out;
+   std::vector<std::string> errors;
+};
+
+static void checkInflate(const uint8_t* stream_, size_t size_, unsigned n_)
+{
+   MemIo     io{stream_, size_};
+   STB::ZLib zlib{&io};
+
+   EXPECT_EQ(n_, zlib.inflate());
+
+   // Whole stream consumed including the Adler-32 trailer and no more
+   EXPECT_EQ(size_, io.index);
+   EXPECT_EQ(0, io.overrun);
+   EXPECT_EQ(0, io.errors.size());
+   EXPECT_TRUE(io.out == testData(n_));
+}
+
+TEST(STB_Deflate, stored)
+{
+   checkInflate(zlib_stored, sizeof(zlib_stored), 64);
+}
+
+TEST(STB_Deflate, fixed_huffman)
+{
+   checkInflate(zlib_fixed, sizeof(zlib_fixed), 40);
+}
+
+TEST(STB_Deflate, dynamic_huffman)
+{
+   checkInflate(zlib_dynamic, sizeof(zlib_dynamic), 1024);
+}
+
+TEST(STB_Deflate, bad_block_type)
+{
+   // Final block with reserved BTYPE 11
+   const uint8_t stream[] = {0x78, 0x9c, 0x07, 0x00};
+
+   MemIo     io{stream, sizeof(stream)};
+   STB::ZLib zlib{&io};
+
+   EXPECT_EQ(0, zlib.inflate());
+   EXPECT_EQ(1, io.errors.size());
+}
+
+TEST(STB_Deflate, adler32)
+{
+   const char* text = "Wikipedia";
+
+   EXPECT_EQ(0x11E60398, STB::ZLib::adler32(1, (const uint8_t*)text, 9));
+
+   // Long enough to need several deferred reductions
+   std::vector<uint8_t> ones(20000, 0xFF);
+   uint32_t             a = 1;
+   uint32_t             b = 0;
+
+   for(uint8_t byte : ones)
+   {
+      a = (a + byte) % 65521;
+      b = (b + a) % 65521;
+   }
+
+   EXPECT_EQ((b << 16) | a, STB::ZLib::adler32(1, ones.data(), ones.size()));
+}
+
+//! Io with only the bulk interface implemented
+class BulkIo : public STB::ZLib::Io
+{
+public:
+   BulkIo(const uint8_t* data_, size_t size_)
+      : data(data_)
+      , size(size_)
+   {
+   }
+
+   size_t read(uint8_t* data_, size_t size_) override
+   {
+      size_t len = std::min(size - index, size_);
+
+      memcpy(data_, data + index, len);
+      index += len;
+      ++reads;
+
+      return len;
+   }
+
+   void write(const uint8_t* data_, size_t size_) override
+   {
+      out.insert(out.end(), data_, data_ + size_);
+   }
+
+   const uint8_t*       data;
+   size_t               size;
+   size_t               index{0};
+   unsigned             reads{0};
+   std::vector<uint8_t> out;
+};
+
+TEST(STB_Deflate, bulk_io)
+{
+   BulkIo    io{zlib_dynamic, sizeof(zlib_dynamic)};
+   STB::ZLib zlib{&io};
+
+   EXPECT_EQ(1024, zlib.inflate());
+   EXPECT_TRUE(io.out == testData(1024));
+   EXPECT_LT(io.reads, 8);
+}
+
+TEST(STB_Deflate, pull)
+{
+   BulkIo    io{zlib_dynamic, sizeof(zlib_dynamic)};
+   STB::ZLib zlib{&io};
+
+   std::vector<uint8_t> out;
+   uint8_t              part[7];
+
+   while(true)
+   {
+      size_t n = zlib.inflate(part, sizeof(part));
+
+      out.insert(out.end(), part, part + n);
+
+      if (n < sizeof(part)) break;
+   }
+
+   EXPECT_TRUE(out == testData(1024));
+   EXPECT_EQ(0, zlib.inflate(part, sizeof(part)));
+}
+
+static void checkRoundTrip(unsigned n_, STB::Deflate::Level level_, unsigned log2_window_size_)
+{
+   std::vector<uint8_t> data = testData(n_);
+
+   BulkIo    src{data.data(), data.size()};
+   STB::ZLib encoder{&src};
+
+   size_t size = encoder.deflate(level_, log2_window_size_);
+
+   EXPECT_EQ(size, src.out.size());
+   EXPECT_NE(0, size);
+
+   BulkIo    dst{src.out.data(), src.out.size()};
+   STB::ZLib decoder{&dst};
+
+   EXPECT_EQ(n_, decoder.inflate());
+   EXPECT_TRUE(dst.out == data);
+}
+
+TEST(STB_Deflate, deflate_store)
+{
+   checkRoundTrip(70000, STB::Deflate::STORE, 15);
+}
+
+TEST(STB_Deflate, deflate_fixed)
+{
+   checkRoundTrip(5000, STB::Deflate::FIXED, 15);
+}
+
+TEST(STB_Deflate, deflate_dynamic)
+{
+   checkRoundTrip(20000, STB::Deflate::DYNAMIC, 15);
+
+   // Repeats make the stream smaller than the input
+   std::vector<uint8_t> data = testData(20000);
+   BulkIo               src{data.data(), data.size()};
+   STB::ZLib            encoder{&src};
+
+   EXPECT_LT(encoder.deflate(), data.size());
+}
+
+TEST(STB_Deflate, deflate_small_window)
+{
+   checkRoundTrip(5000, STB::Deflate::DYNAMIC, 9);
+}
+
+TEST(STB_Deflate, deflate_byte_io)
+{
+   // Input from getByte() until atEnd()
+   std::vector<uint8_t> data = testData(3000);
+
+   MemIo     src{data.data(), data.size()};
+   STB::ZLib encoder{&src};
+
+   size_t size = encoder.deflate();
+
+   EXPECT_EQ(size, src.out.size());
+   EXPECT_EQ(0, src.overrun);
+
+   checkInflate(src.out.data(), src.out.size(), 3000);
+}
+
+TEST(STB_Deflate, deflate_empty)
+{
+   checkRoundTrip(0, STB::Deflate::DYNAMIC, 15);
+}
@@ -23,3 +23,43 @@ TEST(STB_FAT16, construct)
       if ((i % 16) == 15) putchar('\n');
    }
 }
+
+TEST(STB_FAT16, file_sectors)
+{
+   STB::FAT16<1> fat16{"TEST"};
+
+   // Files spanning one, several and a partial cluster
+   static uint8_t small[100];
+   static uint8_t large[5 * 4096 + 512];
+   static uint8_t other[4096];
+
+   for(unsigned i = 0; i < sizeof(small); ++i) small[i] = uint8_t(i);
+   for(unsigned i = 0; i < sizeof(large); ++i) large[i] = uint8_t(i * 7 + 1);
+   for(unsigned i = 0; i < sizeof(other); ++i) other[i] = uint8_t(i * 3 + 2);
+
+   fat16.addFile("SMALL.TXT", sizeof(small), small);
+   fat16.addFile("LARGE.BIN", sizeof(large), large);
+   fat16.addFile("OTHER.BIN", sizeof(other), other);
+
+   // Data sectors follow the VBR, two FATs and one root directory sector
+   const uint32_t lba_data = 1 + 2 * 2 + 1;
+
+   // Clusters are allocated in order from 2 and 8 sectors long
+   EXPECT_EQ(small,              fat16.getFilePointer(lba_data));
+   EXPECT_EQ(large,              fat16.getFilePointer(lba_data + 8));
+   EXPECT_EQ(large + 512,        fat16.getFilePointer(lba_data + 9));
+   EXPECT_EQ(large + 5 * 4096,   fat16.getFilePointer(lba_data + 8 + 5 * 8));
+   EXPECT_EQ(other,              fat16.getFilePointer(lba_data + 8 + 6 * 8));
+   EXPECT_EQ(other + 7 * 512,    fat16.getFilePointer(lba_data + 8 + 6 * 8 + 7));
+   EXPECT_EQ(nullptr,            fat16.getFilePointer(lba_data + 8 + 7 * 8));
+
+   // Read a whole sector back in 64 byte parts
+   uint8_t block[512];
+
+   for(unsigned offset = 0; offset < sizeof(block); offset += 64)
+   {
+      fat16.read(lba_data + 10, offset, 64, block + offset);
+   }
+
+   EXPECT_EQ(0, memcmp(block, large + 2 * 512, sizeof(block)));
+}
@@ -120,14 +120,37 @@ protected:
    //! Render a character in the terminal emulation
    virtual void renderChar(unsigned col, unsigned row, uint8_t ch, Attr at) = 0;
 
+   //! Move the rendering of rows top+1..btm up by one row
+   //
+   //! \return false if not supported and the rows must be re-rendered
+   virtual bool renderScroll(unsigned top, unsigned btm) { return false; }
+
+   //! Make a changed area (inclusive cell range) of the rendering visible
+   virtual void renderRefresh(unsigned col1, unsigned row1, unsigned col2, unsigned row2) {}
+
    //! Return a string from terminal emulation
    virtual void returnString(const char* s) = 0;
 
+   //! Draw the cursor, pending changes are rendered first so it is not lost
    void drawCursor(Cursor mode)
    {
+      renderDirty();
+
       drawChar(col, row, mode);
    }
 
+   //! Render all changed cells and refresh the area of the display affected
+   void update()
+   {
+      renderDirty();
+
+      if (damage.isEmpty()) return;
+
+      renderRefresh(damage.col1, damage.row1, damage.col2, damage.row2);
+
+      damage.clear();
+   }
+
    //! Redraw the screen
    void redraw()
    {
@@ -141,6 +164,75 @@ protected:
    }
 
 private:
+   //! Inclusive range of changed cells
+   struct Rect
+   {
+      Rect() { clear(); }
+
+      bool isEmpty() const { return col1 > col2; }
+
+      void clear()
+      {
+         col1 = row1 = ~0u;
+         col2 = row2 = 0;
+      }
+
+      void add(unsigned c1, unsigned r1, unsigned c2, unsigned r2)
+      {
+         if (c1 < col1) col1 = c1;
+         if (r1 < row1) row1 = r1;
+         if (c2 > col2) col2 = c2;
+         if (r2 > row2) row2 = r2;
+      }
+
+      unsigned col1, row1, col2, row2;
+   };
+
+   //! Inclusive range of columns in a row waiting to be rendered
+   struct Span
+   {
+      bool isEmpty() const { return first > last; }
+
+      void clear()
+      {
+         first = MAX_COLS;
+         last  = 0;
+      }
+
+      void add(unsigned c1, unsigned c2)
+      {
+         if (c1 < first) first = c1;
+         if (c2 > last)  last  = c2;
+      }
+
+      uint16_t first{MAX_COLS};
+      uint16_t last{0};
+   };
+
+   //! Mark a range of cells in a row as needing to be rendered
+   void markDirty(unsigned c1, unsigned c2, unsigned r)
+   {
+      dirty[r - 1].add(c1, c2);
+   }
+
+   //! Render all cells marked as dirty
+   void renderDirty()
+   {
+      for(unsigned r = 1; r <= num_rows; ++r)
+      {
+         Span& span = dirty[r - 1];
+
+         if (span.isEmpty()) continue;
+
+         for(unsigned c = span.first; c <= span.last; ++c)
+         {
+            drawChar(c, r);
+         }
+
+         span.clear();
+      }
+   }
+
    //! Return an integer as a string
    void returnInt(signed value)
    {
@@ -360,7 +452,7 @@ private:
 
    void drawChar(unsigned c, unsigned r, Cursor cursor_mode = Cursor::OFF)
    {
-      Attr at = cell_attr[c - 1][r - 1];
+      Attr at = cell_attr[r - 1][c - 1];
 
       switch(cursor_mode)
       {
@@ -369,29 +461,44 @@ private:
       case Cursor::BLOCK: at.setInvert(!at.isInvert()); break;
       }
 
-      renderChar(c, r, cell_char[c - 1][r - 1], at);
+      renderChar(c, r, cell_char[r - 1][c - 1], at);
+
+      damage.add(c, r, c, r);
    }
 
    void scroll()
    {
-      for(unsigned r = top_margin; r < btm_margin; ++r)
+      if (btm_margin > top_margin)
       {
-         for(unsigned c = 1; c <= num_cols; ++c)
-         {
-            cell_char[c - 1][r - 1] = cell_char[c - 1][r];
-            cell_attr[c - 1][r - 1] = cell_attr[c - 1][r];
+         unsigned rows = btm_margin - top_margin;
 
-            drawChar(c, r);
+         memmove(cell_char[top_margin - 1], cell_char[top_margin], rows * sizeof(cell_char[0]));
+         memmove(cell_attr[top_margin - 1], cell_attr[top_margin], rows * sizeof(cell_attr[0]));
+
+         // Cells not yet rendered move with their cells
+         memmove(&dirty[top_margin - 1], &dirty[top_margin], rows * sizeof(Span));
+
+         if (renderScroll(top_margin, btm_margin))
+         {
+            damage.add(1, top_margin, num_cols, btm_margin);
+         }
+         else
+         {
+            for(unsigned r = top_margin; r < btm_margin; ++r)
+            {
+               markDirty(1, num_cols, r);
+            }
          }
       }
 
       for(unsigned c = 1; c <= num_cols; ++c)
       {
-         cell_char[c - 1][btm_margin - 1] = ' ';
-         cell_attr[c - 1][btm_margin - 1].reset();
-
-         drawChar(c, btm_margin);
+         cell_char[btm_margin - 1][c - 1] = ' ';
+         cell_attr[btm_margin - 1][c - 1].reset();
       }
+
+      dirty[btm_margin - 1].clear();
+      markDirty(1, num_cols, btm_margin);
    }
 
    void nextLine()
@@ -409,10 +516,10 @@ private:
 
    virtual void ansiGraphic(uint8_t ch) override
    {
-      cell_char[col - 1][row - 1] = ch;
-      cell_attr[col - 1][row - 1] = attr;
+      cell_char[row - 1][col - 1] = ch;
+      cell_attr[row - 1][col - 1] = attr;
 
-      drawChar(col, row);
+      markDirty(col, col, row);
 
       implicit_cr = (col == signed(num_cols));
       if(implicit_cr)
@@ -558,8 +665,10 @@ private:
    signed   save_col{}, save_row{};
    Attr     attr;
    bool     echo{};
-   Attr     cell_attr[MAX_COLS][MAX_ROWS];
-   uint8_t  cell_char[MAX_COLS][MAX_ROWS];
+   Attr     cell_attr[MAX_ROWS][MAX_COLS];
+   uint8_t  cell_char[MAX_ROWS][MAX_COLS];
+   Span     dirty[MAX_ROWS];
+   Rect     damage;
    bool     implicit_cr{false};
    uint8_t  sgr_state{0};
    uint8_t  sgr_state_red{0};
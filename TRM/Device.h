@@ -28,6 +28,7 @@ public:
    static const unsigned long IOCTL_TERM_CURSOR      = IOCTL_TERM(10);
    static const unsigned long IOCTL_TERM_SLEEP       = IOCTL_TERM(11);
    static const unsigned long IOCTL_TERM_SLEEP_IMAGE = IOCTL_TERM(12);
+   static const unsigned long IOCTL_TERM_SAVE_IMAGE  = IOCTL_TERM(13);
 
    virtual int open(unsigned oflag) { return 0; }
 
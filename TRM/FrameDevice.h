@@ -7,6 +7,7 @@
 
 #include <cassert>
 #include <cstdarg>
+#include <cstring>
 
 #include "STB/Fifo.h"
 
@@ -15,6 +16,7 @@
 #include "GUI/Font/Teletext.h"
 #include "GUI/Frame.h"
 #include "GUI/Bitmap.h"
+#include "GUI/GlyphCache.h"
 
 #include "TRM/AnsiImpl.h"
 #include "TRM/Device.h"
@@ -137,6 +139,15 @@ public:
          }
          break;
 
+      case IOCTL_TERM_SAVE_IMAGE:
+         // Include any output not yet rendered
+         this->update();
+         if (frame.savePNG(va_arg(ap, const char*)))
+         {
+            status = 0;
+         }
+         break;
+
       default:
          break;
       }
@@ -156,6 +167,9 @@ public:
          this->ansiWrite(ch);
       }
 
+      // Render the whole buffer in one pass
+      this->update();
+
       return n;
    }
 
@@ -168,7 +182,7 @@ public:
       for(i = 0; i < n; i++)
       {
          if (draw_cursor) this->drawCursor(Impl::Cursor::BLOCK);
-         frame.refresh();
+         this->update();
 
          uint8_t ch = getInput();
 
@@ -197,7 +211,8 @@ public:
    using Device::write;
 
 private:
-   using Impl = AnsiImpl<WIDTH / MIN_FONT_WIDTH, HEIGHT / MIN_FONT_HEIGHT>;
+   using Impl   = AnsiImpl<WIDTH / MIN_FONT_WIDTH, HEIGHT / MIN_FONT_HEIGHT>;
+   using Glyphs = GUI::GlyphCache<>;
 
    STB::Colour convertCol256ToRGB(uint8_t col, bool bg)
    {
@@ -287,21 +302,52 @@ private:
       unsigned x = org.x + (c - 1) * font->getWidth();
       unsigned y = org.y + (r - 1) * (font->getHeight() + line_space);
 
-      frame.fillRect(bg, x, y, x + font->getWidth(), y + font->getHeight() + line_space);
-
-      frame.drawChar(fg, bg, x, y + line_space, font, ch);
+      unsigned style = 0;
 
       if(at.isBold())
       {
-         frame.drawChar(fg, bg, x + 1, y + line_space, font, ch);
+         style |= Glyphs::BOLD;
       }
 
       // TODO use an italic font for italics
       if(at.isUnderline() || at.isItalic())
       {
-         frame.drawLine(fg, x, y + font->getHeight() - 1, x + font->getWidth(),
-                        y + font->getHeight() - 1);
+         style |= Glyphs::UNDERLINE;
       }
+
+      glyphs.drawChar(frame, fg, bg, x, y, font, ch, style);
+   }
+
+   virtual bool renderScroll(unsigned top, unsigned btm) override
+   {
+      const PLT::Image* image = frame.getImage();
+      if (image == nullptr) return false;
+
+      unsigned pitch;
+      uint8_t* pixels = image->getStorage(pitch);
+      if (pixels == nullptr) return false;
+
+      // Move whole lines of the frame buffer, the margins either side of
+      // the text are background and so unaffected
+      unsigned line_height = font->getHeight() + line_space;
+      unsigned y           = org.y + (top - 1) * line_height;
+      unsigned height      = (btm - top) * line_height;
+
+      memmove(pixels + y * pitch,
+              pixels + (y + line_height) * pitch,
+              height * pitch);
+
+      return true;
+   }
+
+   virtual void renderRefresh(unsigned c1, unsigned r1, unsigned c2, unsigned r2) override
+   {
+      unsigned line_height = font->getHeight() + line_space;
+
+      frame.refresh(org.x + (c1 - 1) * font->getWidth(),
+                    org.y + (r1 - 1) * line_height,
+                    org.x + c2 * font->getWidth(),
+                    org.y + r2 * line_height);
    }
 
    virtual void returnString(const char* s) override
@@ -454,6 +500,8 @@ private:
       org.x = (WIDTH - (cols * font->getWidth())) / 2;
       org.y = border;
 
+      glyphs.resize(font->getWidth(), font->getHeight() + line_space, line_space);
+
       frame.clear(default_bg_col);
    }
 
@@ -472,6 +520,7 @@ private:
    unsigned              timeout_ms{0};
    unsigned              sleep_ms{0};
    GUI::Bitmap           sleep_image{};
+   Glyphs                glyphs;
    STB::Fifo<uint8_t, 6> response;
    bool                  shift{false};
    bool                  caps_lock{false};